@@ -80,9 +80,21 @@ namespace Pulsar {
     //! The main loop
     virtual void run ();
 
-    //! Load file
+    //! Load, process and finish the file with the specified index
+    void run_file (unsigned ifile);
+
+    //! Divide the files among nprocess child processes
+    void run_fork ();
+
+    //! Advise the operating system that the specified file will be read
+    void read_ahead (unsigned ifile);
+
+    //! Load file and apply the per-Archive processing of each option
     virtual Archive* load (const std::string& filename);
 
+    //! Read file, before any options are applied
+    virtual Archive* read (const std::string& filename);
+
     //! Data analysis tasks implemented by most derived classes
     virtual void process (Archive*) = 0;
 
@@ -111,6 +123,16 @@ namespace Pulsar {
     //! true if application receives a script name as the first file
     bool stow_script;
 
+    //! true if each file is processed independently of the others
+    /*! When true, the --nproc option is added to the command line menu */
+    bool independent_files;
+
+    //! number of files processed concurrently by child processes
+    unsigned nprocess;
+
+    //! number of files read ahead of the file being processed
+    unsigned nread_ahead;
+
     // name of the application
     std::string name;
 
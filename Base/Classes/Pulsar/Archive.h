@@ -22,6 +22,7 @@
 #include "Types.h"
 
 #include <iostream>
+#include <set>
 
 template<typename T> class Jones;
 
@@ -83,6 +84,16 @@ namespace Pulsar
     //! Factory returns a new instance loaded from filename
     static Archive* load (const std::string& name);
 
+    //! Load only the header information required to query metadata
+    /*! When true, derived classes may skip loading the Extensions that
+      are stored separately from the main header (e.g. PSRFITS binary
+      tables), except those named in header_only_extensions.  An
+      Archive loaded in this mode may not be unloaded. */
+    static bool header_only;
+
+    //! Names (or short names) of Extensions loaded when header_only is true
+    static std::set<std::string> header_only_extensions;
+
     //! Returns the number of Archive instances currently in existence
     static unsigned get_instance_count ();
 
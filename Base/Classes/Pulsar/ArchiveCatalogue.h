@@ -0,0 +1,101 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Base/Classes/Pulsar/ArchiveCatalogue.h
+
+#ifndef __Pulsar_ArchiveCatalogue_h
+#define __Pulsar_ArchiveCatalogue_h
+
+#include "ReferenceAble.h"
+
+#include <string>
+#include <vector>
+#include <map>
+
+namespace Pulsar {
+
+  class Archive;
+
+  //! A persistent catalogue of the metadata of many archives
+
+  /*! The catalogue is indexed by filename and stores the modification
+    time and size of each file, so that only new or modified files
+    need to be loaded when the catalogue is updated.  For each file,
+    the catalogue stores the values of the Archive::Interface
+    attributes (excluding those of the sub-integrations) and any
+    additional attributes set by the application. */
+  class ArchiveCatalogue : public Reference::Able
+  {
+
+  public:
+
+    //! The catalogued attributes of a single file
+    class Entry
+    {
+    public:
+
+      //! Default constructor
+      Entry () { mtime = 0; size = 0; }
+
+      //! File modification time (seconds since the epoch)
+      long long mtime;
+
+      //! File size (bytes)
+      long long size;
+
+      //! Attribute values, indexed by name
+      std::map<std::string, std::string> attributes;
+
+      //! Get the named value; return false if not catalogued
+      bool get (const std::string& name, std::string& value) const;
+
+      //! Set the named value
+      void set (const std::string& name, const std::string& value)
+      { attributes[name] = value; }
+    };
+
+    //! Default constructor
+    ArchiveCatalogue ();
+
+    //! Load the catalogue from filename, if it exists
+    void load (const std::string& filename);
+
+    //! Unload the catalogue to filename
+    void unload (const std::string& filename) const;
+
+    //! Return the entry for filename, if its mtime and size are unchanged
+    const Entry* find_current (const std::string& filename) const;
+
+    //! Return the entry for filename, if any
+    const Entry* find (const std::string& filename) const;
+
+    //! Replace the entry for filename with the attributes of archive
+    /*! If archive is null, the file is catalogued without attributes
+      (e.g. because it could not be loaded) and is not loaded again
+      until it is modified. */
+    Entry* update (const std::string& filename, Archive* archive);
+
+    //! Get the names of all catalogued files, in sorted order
+    void get_filenames (std::vector<std::string>& filenames) const;
+
+    //! Return true if the catalogue has been modified since loaded
+    bool get_modified () const { return modified; }
+
+  protected:
+
+    //! The entries, indexed by filename
+    std::map<std::string, Entry> entries;
+
+    //! Set when the entries are modified
+    bool modified;
+
+  };
+
+}
+
+#endif
@@ -15,7 +15,16 @@
 
 namespace Pulsar
 {
-  /*! Extra pulse profiles to represent other dimensions */
+  class PhaseResampler;
+
+  /*! Extra pulse profiles to represent other dimensions
+
+    The amplitudes of all profiles are stored in a single contiguous
+    block of memory, so that operations applied to every profile
+    (e.g. during tscrunch, fscrunch and bscrunch) are performed by
+    simple loops over the entire block.  If any profile is resized
+    independently of the others, operations revert to being applied
+    to each profile in turn. */
   class MoreProfiles : public DataExtension
   {
   public:
@@ -26,6 +35,9 @@ namespace Pulsar
     //! Copy constructor
     MoreProfiles (const MoreProfiles&);
 
+    //! Destructor
+    ~MoreProfiles ();
+
     //! Return the number of phase bins
     unsigned get_nbin () const;
     
@@ -56,6 +68,9 @@ namespace Pulsar
     //! integrate neighbouring sections of the profile
     void fold (unsigned nfold);
 
+    //! resample every profile using the shared work space
+    void resample (PhaseResampler*);
+
     //! integrate information from another Profile
     void integrate (const Profile*);
 
@@ -74,11 +89,26 @@ namespace Pulsar
     //! get the ith const Profile
     virtual const Profile* get_Profile (unsigned i) const;
 
+    //! Return true if the amplitudes are stored in a single block
+    bool is_contiguous () const;
+
   protected:
 
     //! vector of Profile instances
     std::vector< Reference::To<Profile> > profile;
 
+    //! amplitudes of every Profile, stored in order
+    std::vector<float> amps;
+
+    //! number of phase bins in each Profile stored in amps
+    unsigned amps_nbin;
+
+    //! store the amplitudes of every Profile in amps
+    void pack (unsigned nbin);
+
+    //! point each Profile to its amplitudes in amps
+    void share (unsigned nbin);
+
   };
 
 }
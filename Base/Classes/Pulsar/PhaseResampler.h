@@ -0,0 +1,72 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Base/Classes/Pulsar/PhaseResampler.h
+
+#ifndef __Pulsar_PhaseResampler_h
+#define __Pulsar_PhaseResampler_h
+
+#include <vector>
+
+namespace Pulsar
+{
+  class Profile;
+
+  //! Changes the number of phase bins in blocks of profiles
+  /*! The amplitudes of nprof profiles, each with nbin phase bins, are
+    stored contiguously; every operation compacts the block in place,
+    so that on return the amplitudes of each profile are stored with
+    the new number of phase bins.
+
+    The integer-factor kernels form each sum in single precision, in
+    the same order as the original per-profile loops.  When the new
+    number of bins does not divide the current number, the profiles
+    are resampled by truncating the Fourier series; a single instance
+    reuses its work space for every profile that it resamples. */
+  class PhaseResampler
+  {
+  public:
+
+    //! Integrate each group of nscrunch neighbouring phase bins
+    static void bscrunch (float* amps, unsigned nprof,
+			  unsigned nbin, unsigned nscrunch);
+
+    //! Integrate the nfold sections of each profile
+    static void fold (float* amps, unsigned nprof,
+		      unsigned nbin, unsigned nfold);
+
+    //! Construct the Fourier resampler from nbin to new_nbin phase bins
+    PhaseResampler (unsigned nbin, unsigned new_nbin);
+
+    //! Get the number of phase bins in each input profile
+    unsigned get_nbin () const { return nbin; }
+
+    //! Get the number of phase bins in each output profile
+    unsigned get_new_nbin () const { return new_nbin; }
+
+    //! Resample the block of profiles
+    void resample (float* amps, unsigned nprof = 1);
+
+    //! Resample the profile and all of its extensions
+    void resample (Profile*);
+
+  protected:
+
+    unsigned nbin;
+    unsigned new_nbin;
+
+    //! The Fourier transform of the current profile
+    std::vector<float> spectrum;
+
+    //! The resampled profile
+    std::vector<float> solution;
+  };
+
+}
+
+#endif
@@ -77,6 +77,9 @@ namespace Pulsar {
     //! size of the amps array (always >= nbin)
     unsigned amps_size;
 
+    //! true when amps points to memory owned by another object
+    bool amps_shared;
+
   };
 
 }
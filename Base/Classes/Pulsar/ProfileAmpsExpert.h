@@ -35,6 +35,19 @@ namespace Pulsar {
     static void set_amps_ptr (ProfileAmps* instance, float* amps)
     { instance->amps = amps; }
 
+    //! Use nbin amplitudes owned by another object
+    /*! Any memory owned by instance is freed; the shared memory is
+      not freed by instance, and must remain valid until instance is
+      resized to more than nbin phase bins or destroyed. */
+    static void share_amps (ProfileAmps* instance, float* amps, unsigned nbin)
+    {
+      instance->ProfileAmps::resize (0);
+      instance->amps = amps;
+      instance->amps_size = nbin;
+      instance->nbin = nbin;
+      instance->amps_shared = true;
+    }
+
   private:
 
     //! instance
@@ -203,6 +203,9 @@ namespace Pulsar
 
     //! Load the FITS header information from filename
     virtual void load_header (const char* filename);
+
+    //! Return false if header_only is set and the named HDU is not required
+    bool load_hdu (const char* hdu_name) const;
     
     //! Load the specified Integration from filename, returning new instance
     virtual Integration*
@@ -337,6 +340,9 @@ namespace Pulsar
     // Flag set when data are loaded from a PSRFITS file
     bool loaded_from_fits;
 
+    // Flag set when only the header information was loaded
+    bool loaded_header_only;
+
     //! Number of auxiliary profiles stored in each channel
     mutable unsigned naux_profile;
 
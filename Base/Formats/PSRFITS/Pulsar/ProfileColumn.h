@@ -13,6 +13,7 @@
 
 #include "Pulsar/Config.h"
 #include <fitsio.h>
+#include <stdint.h>
 
 namespace Pulsar {
 
@@ -26,6 +27,9 @@ namespace Pulsar {
 
     static Option<bool> output_floats;
 
+    //! Number of threads used to quantise profile amplitudes
+    static Option<unsigned> nthread;
+
     //! Default constructor
     ProfileColumn ();
 
@@ -103,6 +107,21 @@ namespace Pulsar {
 
     template<typename T, typename C>
     void load_amps (int row, C&, bool must_have_scloffs = true);
+
+    //! Compute the offset, scale and 16-bit amplitudes of a range of profiles
+    void quantise (unsigned start, unsigned end);
+
+    //! The profiles passed to unload
+    const std::vector<const Profile*>* unload_profiles = nullptr;
+
+    //! Workspace: offset of each profile
+    std::vector<float> offsets;
+
+    //! Workspace: scale of each profile
+    std::vector<float> scales;
+
+    //! Workspace: 16-bit representation of profile amplitudes
+    std::vector<int16_t> compressed;
   };
 
 }
@@ -60,6 +60,18 @@ namespace Pulsar {
     //! Get the phase bin scrunch factor
     const ScrunchFactor get_bscrunch () const { return bscrunch_factor; }
 
+    //! Compute eigenvectors from the profiles when fewer than phase bins
+    void set_low_rank (bool flag) { low_rank = flag; built = false; }
+    bool get_low_rank () const { return low_rank; }
+
+    //! Include the variance outside of the principal components
+    void set_diagonal (bool flag) { diagonal = flag; built = false; }
+    bool get_diagonal () const { return diagonal; }
+
+    //! Fraction of profiles used to compute the covariance matrix
+    void set_subsample (double f) { subsample = f; built = false; }
+    double get_subsample () const { return subsample; }
+
     //! Archive used to set up
     void set_setup_Archive (const Archive*);
 
@@ -87,6 +99,15 @@ namespace Pulsar {
     //! Compute covariance matrix from bscrunched clone of data
     ScrunchFactor bscrunch_factor;
 
+    //! Compute eigenvectors from the profiles when fewer than phase bins
+    bool low_rank;
+
+    //! Include the variance outside of the principal components
+    bool diagonal;
+
+    //! Fraction of profiles used to compute the covariance matrix
+    double subsample;
+
     // what to compare
     std::string what;
     // dimension along which to compare
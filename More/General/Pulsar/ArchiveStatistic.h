@@ -15,6 +15,8 @@
 #include "Identifiable.h"
 #include "TextInterface.h"
 
+#include <vector>
+
 namespace Pulsar {
 
   //! Commmon statistics that can be derived from an Archive
@@ -31,6 +33,9 @@ namespace Pulsar {
 
     //! File to which auxiliary data will be printed
     FILE* fptr;
+
+    //! Number of threads used to compute the statistic over the grid
+    unsigned nthread;
     
   public:
 
@@ -55,6 +60,45 @@ namespace Pulsar {
 
     //! Close the file to which auxiliary data were printed
     virtual void fclose ();
+
+    //! Return true if clones of this instance may be evaluated concurrently
+    /*! Derived types that share mutable state between clones, modify
+      the archive, or print auxiliary data should return false */
+    virtual bool is_thread_safe () const { return false; }
+
+    //! Set the number of threads used to compute the statistic over the grid
+    void set_nthread (unsigned n) { nthread = n; }
+    //! Get the number of threads used to compute the statistic over the grid
+    unsigned get_nthread () const { return nthread; }
+
+    //! Compute the statistic for each sub-integration, channel and polarization
+    /*! On return, result[(isub*nchan + ichan)*npol + ipol] is the
+      statistic computed for sub-integration isub, channel ichan and
+      polarization pol[ipol], where npol = pol.size().  If compute is
+      not empty, the statistic is computed only where compute[isub*nchan
+      + ichan] is true; the other elements of result are left unchanged.
+
+      If nthread > 1 and is_thread_safe returns true, the grid is
+      divided into nthread contiguous blocks and each block is computed
+      by a separate clone of this instance; the result does not depend
+      on the number of threads. */
+    void get_grid (std::vector<double>& result,
+                   const std::vector<unsigned>& pol,
+                   const std::vector<bool>& compute = std::vector<bool>());
+
+  private:
+
+    //! Shared by the clones that compute the statistic over the grid
+    class Grid;
+
+    //! The grid computed by get_cells
+    Grid* grid;
+
+    //! Compute the statistic over the cells from start to end-1
+    void get_cells (unsigned start, unsigned end);
+
+    //! Compute the statistic over the ijob-th of njob blocks of the grid
+    void get_block (unsigned ijob, unsigned njob);
   };
 
   std::ostream& operator<< (std::ostream&, ArchiveStatistic*);
@@ -16,6 +16,9 @@
 #include "Pulsar/Integration.h"
 #include "Pulsar/Profile.h"
 #include "Physical.h"
+#include "ThreadContext.h"
+
+#include <deque>
 
 namespace Pulsar {
 
@@ -143,6 +146,46 @@ namespace Pulsar {
     //! Execute the correction on the selected range
     void range (Integration*, unsigned start_chan, unsigned end_chan);
 
+    //! The correction in each channel of the selected range
+    void get_corrections (const Integration*,
+                          unsigned start_chan, unsigned end_chan,
+                          std::vector<Type>& corrections);
+
+    //! Corrections computed for a set of frequencies and measures
+    class Table
+    {
+    public:
+      std::vector<double> frequency;
+      double relative_measure;
+      double reference_wavelength;
+      double absolute_measure;
+      Type delta;
+
+      //! The correction in each channel
+      std::vector<Type> correction;
+
+      //! Return true if the corrections were computed for the same inputs
+      bool matches (const Table& that) const
+      {
+        return relative_measure == that.relative_measure
+          && reference_wavelength == that.reference_wavelength
+          && absolute_measure == that.absolute_measure
+          && delta == that.delta
+          && frequency == that.frequency;
+      }
+    };
+
+    //! Tables shared by all instances of this type of correction
+    static std::deque<Table>& get_tables ()
+    { static std::deque<Table> tables; return tables; }
+
+    //! Mutual exclusion of the shared tables
+    static ThreadContext* get_tables_context ()
+    { static ThreadContext* context = new ThreadContext; return context; }
+
+    //! The maximum number of shared tables
+    static const unsigned max_tables = 16;
+
     //! Computes the effect to be corrected with respect to reference frequency
     Calculator relative;
 
@@ -440,9 +483,61 @@ void Pulsar::ColdPlasma<C,H>::range (Integration* data, unsigned start_chan, uns
     throw Error (InvalidRange, "Pulsar::"+name+"::range",
                  "end chan=%d > nchan=%d", end_chan, data->get_nchan());
 
+  std::vector<Type> corrections;
+  get_corrections (data, start_chan, end_chan, corrections);
+
+  for (unsigned ichan=start_chan; ichan < end_chan; ichan++)
+    apply (data, ichan, corrections[ichan-start_chan]);
+}
+catch (Error& error)
+{
+  throw error += "Pulsar::"+name+"::range";
+}
+
+/*! The same corrections are usually applied to every sub-integration
+  in an archive, and to every archive in a set of observations with
+  the same frequency channels and measure; therefore, the most
+  recently computed tables of corrections are shared by all instances
+  of each type of correction.
+
+  \post the frequency of the calculators is that of the last channel
+*/
+template<class C, class H>
+void Pulsar::ColdPlasma<C,H>::get_corrections (const Integration* data,
+                                               unsigned start_chan,
+                                               unsigned end_chan,
+                                               std::vector<Type>& corrections)
+{
+  Table table;
+  table.relative_measure = relative.get_measure();
+  table.reference_wavelength = get_reference_wavelength();
+  table.absolute_measure = absolute.get_measure();
+  table.delta = delta;
+
+  table.frequency.resize (end_chan - start_chan);
+  for (unsigned ichan=start_chan; ichan < end_chan; ichan++)
+    table.frequency[ichan-start_chan] = data->get_centre_frequency (ichan);
+
+  if (end_chan > start_chan)
+    set_frequency( table.frequency.back() );
+
+  {
+    ThreadContext::Lock lock (get_tables_context());
+    std::deque<Table>& tables = get_tables();
+
+    for (unsigned i=0; i < tables.size(); i++)
+      if (tables[i].matches (table))
+      {
+        corrections = tables[i].correction;
+        return;
+      }
+  }
+
+  table.correction.resize (end_chan - start_chan);
+
   for (unsigned ichan=start_chan; ichan < end_chan; ichan++)
   {
-    set_frequency( data->get_centre_frequency (ichan) );
+    set_frequency( table.frequency[ichan-start_chan] );
 
     Type result = delta;
     combine(result, relative.evaluate());
@@ -453,12 +548,17 @@ void Pulsar::ColdPlasma<C,H>::range (Integration* data, unsigned start_chan, uns
                 << "\n\t relative=" << relative.evaluate()
                 << "\n\t absolute=" << absolute.evaluate() << std::endl;
 
-    apply (data, ichan, result);
+    table.correction[ichan-start_chan] = result;
   }
-}
-catch (Error& error)
-{
-  throw error += "Pulsar::"+name+"::range";
+
+  corrections = table.correction;
+
+  ThreadContext::Lock lock (get_tables_context());
+  std::deque<Table>& tables = get_tables();
+
+  tables.push_back (table);
+  if (tables.size() > max_tables)
+    tables.pop_front ();
 }
 
 
@@ -50,6 +50,15 @@ namespace Pulsar {
     /*! Residual after fitting scale and offset */
     bool model_residual;
     bool use_null_space;
+
+    //! Compute the eigenvectors without forming the covariance matrix
+    bool low_rank;
+
+    //! Model the noise outside of the principal components as diagonal
+    bool diagonal;
+
+    //! Fraction of profiles used to compute the covariance matrix
+    double subsample;
     
     //! Transpose indeces when computing results
     bool transpose;
@@ -117,6 +126,17 @@ namespace Pulsar {
     //! Get the phase bin scrunch factor
     const ScrunchFactor get_bscrunch () const { return bscrunch_factor; }
 
+    //! Compute eigenvectors from the profiles when fewer than phase bins
+    void set_low_rank (bool flag) { low_rank = flag; }
+
+    //! Include the variance outside of the principal components
+    void set_diagonal (bool flag) { diagonal = flag; }
+
+    //! Compute the covariance matrix from a random subset of profiles
+    /*! The profiles are selected using a fixed seed, so that the same
+      subset is used each time that the data are set up. */
+    void set_subsample (double fraction) { subsample = fraction; }
+
     //! Return true if call to set_setup_data sets anything up
     /* Not all comparisons require a global set up */
     bool get_setup () { return is_setup; }
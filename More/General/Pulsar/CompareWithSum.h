@@ -13,6 +13,10 @@
 
 #include "Pulsar/CompareWith.h"
 
+namespace BinaryStatistics {
+  class GeneralizedChiSquared;
+}
+
 namespace Pulsar {
 
   //! Summarizes a comparison of each Profile with their sum
@@ -26,6 +30,14 @@ namespace Pulsar {
       
     //! Compute the comparison summary for primary dimension
     void compute (unsigned iprimary, ndArray<2,double>& result);
+
+    //! Compare all profiles with the sum using the generalized chi-squared
+    void compute_batch (BinaryStatistics::GeneralizedChiSquared*,
+                        const std::vector<double>& sumdata,
+                        unsigned iprimary, ndArray<2,double>& result);
+
+    //! Amplitudes of the profiles compared by compute_batch
+    std::vector< std::vector<double> > batch;
   };
 }
 
@@ -0,0 +1,108 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/General/Pulsar/CovarianceAccumulator.h
+
+#ifndef __Pulsar_CovarianceAccumulator_h
+#define __Pulsar_CovarianceAccumulator_h
+
+#include "ReferenceAble.h"
+
+#include <vector>
+#include <stddef.h>
+
+namespace Pulsar {
+
+  //! Accumulates a weighted sum of outer products in blocks of vectors
+  /*! Vectors are buffered until block_size vectors have been added.
+    The block is then added to the sum matrix as a single rank-k
+    update, which makes better use of the cache than one outer product
+    per vector, and the rows of the sum matrix may be divided among
+    multiple threads.  Each element of the sum is accumulated in the
+    order in which the vectors were added; therefore, the result does
+    not depend on the block size or the number of threads.
+
+    Only the upper triangle (column >= row) of the sum matrix is
+    updated; call symmetrize to copy it to the lower triangle. */
+  class CovarianceAccumulator : public Reference::Able
+  {
+
+  public:
+
+    //! Default constructor
+    CovarianceAccumulator ();
+
+    //! Set the dimension of the vectors (discards buffered vectors)
+    void set_dimension (unsigned ndim);
+    //! Get the dimension of the vectors
+    unsigned get_dimension () const { return ndim; }
+
+    //! Set the number of vectors buffered before updating the sum
+    void set_block_size (unsigned);
+    //! Get the number of vectors buffered before updating the sum
+    unsigned get_block_size () const { return block_size; }
+
+    //! Set the number of threads used to update the sum
+    void set_nthread (unsigned n) { nthread = n; }
+    //! Get the number of threads used to update the sum
+    unsigned get_nthread () const { return nthread; }
+
+    //! Set the sum matrix: ndim rows, with stride elements between rows
+    void set_matrix (double* sum, unsigned stride);
+
+    //! Add a vector with the specified weight
+    void add (const float* x, double weight);
+
+    //! Add a vector with the specified weight
+    void add (const double* x, double weight);
+
+    //! Add the buffered vectors to the sum matrix
+    void flush ();
+
+    //! Discard the buffered vectors
+    void reset () { nbuffered = 0; }
+
+    //! Return the number of bytes used to buffer vectors
+    size_t get_buffer_size () const;
+
+    //! Copy the upper triangle of matrix to the lower triangle
+    static void symmetrize (double* matrix, unsigned ndim, unsigned stride);
+
+  protected:
+
+    //! Add the buffered vectors to rows start through end-1
+    void update (unsigned start, unsigned end);
+
+    //! Return the next row of the buffer
+    double* next ();
+
+    //! Dimension of the vectors
+    unsigned ndim;
+
+    //! Maximum number of buffered vectors
+    unsigned block_size;
+
+    //! Number of threads
+    unsigned nthread;
+
+    //! The sum matrix
+    double* matrix;
+    unsigned stride;
+
+    //! The buffered vectors, multiplied by their weights
+    std::vector<double> weighted;
+
+    //! The buffered vectors
+    std::vector<double> buffer;
+    unsigned nbuffered;
+
+  };
+
+}
+
+#endif
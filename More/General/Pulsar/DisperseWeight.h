@@ -42,6 +42,9 @@ namespace Pulsar {
     //! Get the shifted PhaseWeight mask for the specified channel
     void get_weight (unsigned ichan, PhaseWeight*);
 
+    //! Get the number of bins by which the mask is shifted in the specified channel
+    unsigned get_bin_shift (unsigned ichan);
+
   protected:
 
     //! Used to shift PhaseWeight masks by dispersion delay
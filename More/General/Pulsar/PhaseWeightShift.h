@@ -30,6 +30,9 @@ namespace Pulsar {
     //! Returns the shift
     Functor< double() > get_shift;
 
+    //! Return the number of bins by which a mask of nbin bins is shifted
+    unsigned get_bin_shift (unsigned nbin);
+
   protected:
 
     //! Derived classes implement the PhaseWeight calculation
@@ -10,6 +10,9 @@
 #define __Pulsar_ProfilePCA_h
 
 #include "Pulsar/Algorithm.h"
+#include "Pulsar/CovarianceAccumulator.h"
+
+#include <vector>
 
 namespace Pulsar
 {
@@ -51,6 +54,16 @@ namespace Pulsar
     //! Compute principal components.
     void compute();
 
+    //! Compute only the specified number of leading components.
+    /*! If zero (the default), all 2*nharm_pca components are computed. */
+    void set_ncomponent(unsigned n) { ncomponent = n; }
+
+    //! Get the number of computed principal components.
+    unsigned get_npc() const { return pc_values.size(); }
+
+    //! Set the number of threads used to update the cov matrix.
+    void set_nthread(unsigned n);
+
     //! Return i,j cov matrix entry
     double get_cov_value(unsigned i, unsigned j);
 
@@ -98,6 +111,21 @@ namespace Pulsar
     //! Principal component vectors (eigenvectors)
     double *pc_vectors;
 
+    //! Number of leading components to compute
+    unsigned ncomponent;
+
+    //! Number of threads
+    unsigned nthread;
+
+    //! Adds blocks of profiles to the upper triangle of cov
+    CovarianceAccumulator accumulator;
+
+    //! Workspace for the FFT of each profile
+    std::vector<float> fft;
+
+    //! Workspace for the harmonics added to the cov matrix
+    std::vector<float> harmonics;
+
   };
 
 }
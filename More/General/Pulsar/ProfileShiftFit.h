@@ -15,6 +15,8 @@
 #include "toa.h"
 #include "BoxMuller.h"
 
+#include <vector>
+
 namespace Pulsar
 {
   class Profile;
@@ -76,6 +78,15 @@ namespace Pulsar
     //! Get number of iterations
     int get_mcmc_iterations() const { return mcmc_it; }
 
+    //! Set the number of MCMC chains, each computed by a separate thread
+    /*! The iterations are divided between the chains.  When more than
+      one chain is used, each has its own random number generator,
+      seeded deterministically on each call to compute. */
+    void set_mcmc_chains(unsigned n) { mcmc_chains = n; }
+
+    //! Get the number of MCMC chains
+    unsigned get_mcmc_chains() const { return mcmc_chains; }
+
     //! Set the standard or template profile to use
     void set_standard (const Profile* p);
 
@@ -106,6 +117,12 @@ namespace Pulsar
     //! Get the reduced chi-squared
     double get_reduced_chisq () const;
 
+    //! Get the time taken by the last call to compute (in seconds)
+    double get_compute_time () const { return compute_time; }
+
+    //! Get the time taken to compute the shift uncertainty (in seconds)
+    double get_error_time () const { return error_time; }
+
     //! Get the effective duty cycle of the standard
     /*! Refer to Equation 13 of van Straten (2006) or Equation B1 of
       Downs & Reichley (1983) [these equations are Fourier transform
@@ -164,7 +181,15 @@ namespace Pulsar
     //! Number of bins in ccf
     unsigned nbins_ccf;
 
-    
+    //! Real part of the cross power spectrum in double precision
+    std::vector<double> ccf_re;
+
+    //! Imaginary part of the cross power spectrum in double precision
+    std::vector<double> ccf_im;
+
+    //! Evaluate the derivative-th derivative of ccf at phase shift phi
+    double ccf_derivative (double phi, unsigned derivative);
+
     //! Evaluate ccf at phase shift phi
     double ccf(double phi);
 
@@ -195,6 +220,18 @@ namespace Pulsar
     //! Number of iterations to use for MCMC
     int mcmc_it;
 
+    //! Number of MCMC chains
+    unsigned mcmc_chains;
+
+    //! Number of times that the MCMC chains have been seeded
+    unsigned mcmc_seeds;
+
+    //! Time taken by the last call to compute
+    double compute_time;
+
+    //! Time taken to compute the shift uncertainty
+    double error_time;
+
     //! Have valid results been computed
     bool computed;
 
@@ -245,6 +282,18 @@ namespace Pulsar
     //! Return next sample from MCMC sequence
     double mcmc_sample();
 
+    //! The state of one of multiple MCMC chains
+    class Chain;
+
+    //! The MCMC chains
+    std::vector< Reference::To<Chain> > chains;
+
+    //! Calculate the shift variance using multiple MCMC chains
+    void error_mcmc_chains();
+
+    //! Run the specified MCMC chain
+    void mcmc_run (unsigned ichain);
+
     //! Peak log PDF (to help avoid numerical issues)
     double max_log_pdf;
 
@@ -66,11 +66,45 @@ namespace Pulsar
   {
   public:
 
+    //! Default constructor
+    Total ();
+
     //! Remove the baseline
     void transform (Archive*);
 
     //! Remove the baseline
     void operate (Integration*, const PhaseWeight*);
+
+    //! Set the number of threads used to subtract the mean
+    void set_nthread (unsigned n) { nthread = n; }
+    unsigned get_nthread () const { return nthread; }
+
+    //! Subtract the mean of every profile in a single pass
+    /*! When the operation is SubtractMean, the baseline mask is
+      shifted by a whole number of phase bins in each channel;
+      therefore, the mean of every profile in the Integration is
+      computed directly from the shared mask, without constructing a
+      shifted PhaseWeight for each channel. */
+    void set_batch (bool flag = true) { batch = flag; }
+    bool get_batch () const { return batch; }
+
+  protected:
+
+    unsigned nthread;
+    bool batch;
+
+    //! Subtract the mean of every profile using the shared mask
+    void subtract_mean (Integration*, const PhaseWeight*);
+
+  private:
+
+    //! Attributes shared by the threads that subtract the mean
+    Integration* batch_integration;
+    const float* batch_weight;
+    std::vector<unsigned> batch_shift;
+
+    //! Subtract the mean from a block of frequency channels
+    void subtract_channels (unsigned ijob, unsigned njob);
   };
 
   //! Find the baseline from each total intensity profile
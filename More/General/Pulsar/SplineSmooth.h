@@ -10,6 +10,7 @@
 #define __Pulsar_SplineSmooth_h
 
 #include "ReferenceAble.h"
+#include "Bootstrap.h"
 #include "Estimate.h"
 
 namespace Pulsar {
@@ -92,7 +93,7 @@ namespace Pulsar {
     (Methodological), 1977, Vol. 39, No. 1 (1977), pp. 107-113
     https://www.jstor.org/stable/2984885
   */
-  class CrossValidatedSmooth2D
+  class CrossValidatedSmooth2D : public Reference::Able
   {
     bool logarithmic;             // smoothing factors on logarithmic scale
     
@@ -113,6 +114,17 @@ namespace Pulsar {
     std::string gof_filename;
     std::ofstream* gof_out;
 
+    unsigned nthread;             // number of threads used to fit partitions
+
+    class Partitions;
+    Partitions* partitions;
+
+    //! Fit the spline to the estimation data of the specified partition
+    void fit_partition (SplineSmooth2D* spline, unsigned ipart);
+
+    //! Fit the partitions in the specified block
+    void fit_partition_block (unsigned ijob, unsigned njob);
+
   public:
     
     CrossValidatedSmooth2D ();
@@ -121,6 +133,12 @@ namespace Pulsar {
     
     void set_spline (SplineSmooth2D* _spline) { spline = _spline; }
 
+    //! Set the number of threads used to fit the partitions
+    /*! Each thread fits a separate spline; the selected smoothing
+      factor is identical to that selected using one thread. */
+    void set_nthread (unsigned n) { nthread = n; }
+    unsigned get_nthread () const { return nthread; }
+
     //! Set the number of cross-validation iterations, m
     /*! m=40 in Clark (1977) ... m=5 by default */
     void set_npartition (unsigned m) { npartition = m; }
@@ -172,11 +190,13 @@ namespace Pulsar {
     
   };
 
-  class BootstrapUncertainty2D
+  //! Computes bootstrap error bars of a two-dimensional p-spline
+  class BootstrapUncertainty2D : public Bootstrap
   {
-    unsigned nsample;
     SplineSmooth2D* spline;      // the spline implementation
-  
+
+    class SplineFit;
+
   public:
     
     BootstrapUncertainty2D ();
@@ -9,6 +9,7 @@
 #define __Pulsar__TimeDomainCovariance_h
 
 #include "Pulsar/ProfileCovariance.h"
+#include "Pulsar/CovarianceAccumulator.h"
 
 namespace Pulsar
 {
@@ -44,6 +45,30 @@ namespace Pulsar
     //! Compute the eigen decomposition
     void eigen ();
 
+    //! Compute only the specified number of leading eigenvectors
+    /*! If zero (the default), all eigenvectors are computed. */
+    void set_ncomponent (unsigned n) { ncomponent = n; }
+    unsigned get_ncomponent () const { return ncomponent; }
+
+    //! Get the number of computed eigenvalues and eigenvectors
+    unsigned get_neigen () const { return eigenvalues.size(); }
+
+    //! Set the number of threads used to compute the covariance matrix
+    void set_nthread (unsigned);
+
+    //! Set the number of profiles added to the covariance matrix at once
+    void set_block_size (unsigned n) { accumulator.set_block_size (n); }
+
+    //! Compute the eigenvectors without forming the covariance matrix
+    /*! When set, the profiles are stored until their number exceeds
+      the rank.  If fewer profiles than phase bins are added, the
+      eigenvectors of the covariance matrix are derived from those of
+      the much smaller matrix of inner products between the profiles,
+      and the dense covariance matrix is never computed.  Only the
+      eigenvectors with non-zero eigenvalues are computed. */
+    void set_low_rank (bool flag) { low_rank = flag; }
+    bool get_low_rank () const { return low_rank; }
+
     //! Set the eigenvector matrix
     void set_eigenvectors ( const std::vector<double>& );
     void set_eigenvectors ( const double* );
@@ -93,11 +118,39 @@ namespace Pulsar
 
     //! Current covariance matrix (symmetric)
     std::vector<double> covariance_matrix;
+
+    //! Adds blocks of profiles to the upper triangle of covariance_matrix
+    CovarianceAccumulator accumulator;
+
+    //! Compute the eigenvectors from the profiles when count < rank
+    bool low_rank;
+
+    //! Profiles stored in low rank mode (count row vectors)
+    std::vector<double> samples;
+
+    //! Weights of the stored profiles
+    std::vector<double> sample_weights;
+
+    //! Return true if the profiles are stored instead of accumulated
+    bool storing_samples () const
+    { return low_rank && covariance_matrix.empty(); }
+
+    //! Allocate the covariance matrix and add any stored profiles to it
+    void accumulate_samples ();
+
+    //! Compute the eigen decomposition from the stored profiles
+    void eigen_samples ();
+
+    //! Number of leading eigenvectors to compute
+    unsigned ncomponent;
+
+    //! Number of threads
+    unsigned nthread;
     
     //! Current mean profile
     std::vector<double> mean;
 
-    //! Eigenvectors (row vectors in row-major order)
+    //! Eigenvectors (get_neigen row vectors in row-major order)
     std::vector<double> eigenvectors;
     
     //! Eigenvalues
@@ -0,0 +1,100 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/General/Pulsar/TruncatedEigen.h
+
+#ifndef __Pulsar_TruncatedEigen_h
+#define __Pulsar_TruncatedEigen_h
+
+#include "ReferenceAble.h"
+
+#include <vector>
+
+namespace Pulsar {
+
+  //! Computes the leading eigenvectors of a symmetric matrix
+  /*! Implements the randomized subspace iteration described by Halko,
+    Martinsson & Tropp (2011, SIAM Review, 53, 217).  The range of the
+    matrix is sampled by its product with ncomponent+oversample random
+    vectors; after niteration power iterations, the matrix is projected
+    onto the orthonormal basis of this subspace and the much smaller
+    projected matrix is diagonalized.  The cost scales as the square of
+    the dimension of the matrix multiplied by the number of random
+    vectors, instead of the cube of the dimension. */
+  class TruncatedEigen : public Reference::Able
+  {
+
+  public:
+
+    //! Default constructor
+    TruncatedEigen ();
+
+    //! Set the number of eigenvectors to compute
+    void set_ncomponent (unsigned n) { ncomponent = n; }
+    //! Get the number of eigenvectors to compute
+    unsigned get_ncomponent () const { return ncomponent; }
+
+    //! Set the number of additional random vectors
+    void set_oversample (unsigned n) { oversample = n; }
+    //! Get the number of additional random vectors
+    unsigned get_oversample () const { return oversample; }
+
+    //! Set the number of power iterations
+    void set_niteration (unsigned n) { niteration = n; }
+    //! Get the number of power iterations
+    unsigned get_niteration () const { return niteration; }
+
+    //! Set the seed of the random number generator
+    void set_seed (long s) { seed = s; }
+
+    //! Set the number of threads used to compute matrix products
+    void set_nthread (unsigned n) { nthread = n; }
+
+    //! Compute the leading eigenvalues and eigenvectors
+    /*! The matrix is ndim by ndim, symmetric, and stored in row-major
+      order.  On return, values contains the ncomponent eigenvalues of
+      greatest magnitude in descending order, and vectors contains the
+      corresponding eigenvectors as row vectors in row-major order. */
+    void solve (unsigned ndim, const double* matrix,
+                std::vector<double>& values, std::vector<double>& vectors);
+
+  protected:
+
+    //! Compute rows start through end-1 of product = matrix * basis
+    void multiply_rows (unsigned start, unsigned end);
+
+    //! Compute product = matrix * basis using nthread threads
+    void multiply ();
+
+    //! Replace product with an orthonormal basis for its columns
+    void orthonormalize ();
+
+    unsigned ncomponent;
+    unsigned oversample;
+    unsigned niteration;
+    long seed;
+    unsigned nthread;
+
+    //! Dimensions of the matrix and the random subspace
+    unsigned ndim;
+    unsigned nvector;
+
+    //! The matrix
+    const double* matrix;
+
+    //! The orthonormal basis, ndim by nvector
+    std::vector<double> basis;
+
+    //! The product of the matrix and the basis, ndim by nvector
+    std::vector<double> product;
+
+  };
+
+}
+
+#endif
@@ -79,6 +79,12 @@ namespace MEAL {
     //! Composite parameter policy
     Composite composite;
 
+    //! Workspace: the gradient of the model
+    std::vector<Result> model_grad;
+
+    //! Workspace: the gradient with respect to the free parameters
+    std::vector<Result> fgrad;
+
     void init () 
     { parameters.resize(N); project = &parameters;
       composite.map (project); matrix_identity (transformation); }
@@ -181,7 +187,6 @@ void MEAL::BasisRule<N,T>::calculate (Result& result,
   for (unsigned i=0; i<N; i++)
     model->set_param (i, params[i]);
 
-  std::vector<Result> model_grad;
   std::vector<Result>* model_grad_ptr = 0;
   if (grad)
     model_grad_ptr = & model_grad;
@@ -201,7 +206,7 @@ void MEAL::BasisRule<N,T>::calculate (Result& result,
     ProjectGradient (model, model_grad, *(grad));
 
     // map the scalar gradients
-    std::vector<Result> fgrad (N, 0);
+    fgrad.assign (N, 0);
 
     for (igrad=0; igrad<N; igrad++)
       for (unsigned idep=0; idep<N; idep++)
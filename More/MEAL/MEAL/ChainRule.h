@@ -108,6 +108,12 @@ namespace MEAL {
     //! Composite parameter policy
     Composite composite;
 
+    //! Workspace: the gradient of the model
+    std::vector<Result> model_grad;
+
+    //! Workspace: the gradient with respect to the Scalar parameters
+    std::vector<Result> fgrad;
+
   };
 
   /*! Utility for computing the covariances of parameters
@@ -273,7 +279,6 @@ void MEAL::ChainRule<T>::calculate (Result& result,
 		      constraints[ifunc].scalar->evaluate(fgrad));
   }
 
-  std::vector<Result> model_grad;
   std::vector<Result>* model_grad_ptr = 0;
   if (grad)
     model_grad_ptr = & model_grad;
@@ -293,8 +298,6 @@ void MEAL::ChainRule<T>::calculate (Result& result,
     ProjectGradient (model, model_grad, *(grad));
 
     // map the scalar gradients
-    std::vector<Result> fgrad;
-
     for (unsigned ifunc=0; ifunc<constraints.size(); ifunc++)
     {
       unsigned iparam = constraints[ifunc].parameter;
@@ -0,0 +1,166 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/MEAL/MEAL/Cholesky.h
+
+#ifndef __MEAL_Cholesky_h
+#define __MEAL_Cholesky_h
+
+#include "Error.h"
+
+#include <vector>
+#include <iostream>
+#include <cmath>
+
+namespace MEAL {
+
+  /*! Linear equation solution by LDL^T decomposition of a symmetric,
+      positive-definite matrix stored contiguously in row-major order.
+
+      a (N x N) is the input matrix; only the lower triangle is used
+      b (N x M) is input containing the M right-hand side vectors
+
+      On output, b is replaced by the corresponding set of solution
+      vectors.  If invert is true, a is replaced by its matrix inverse;
+      otherwise, its lower triangle is replaced by the unit lower
+      triangular factor L and its diagonal by D.
+
+      An exception is thrown if any element of D is less than or equal
+      to singular_threshold.
+
+      The return value is log(abs(det(a)))
+  */
+  template <class T>
+    T Cholesky (std::vector<T>& a, std::vector<T>& b,
+                unsigned nrow, unsigned ncol = 1, bool invert = false,
+                double singular_threshold = 0.0,
+                std::vector<const char*>* names = 0);
+}
+
+template <class T>
+T MEAL::Cholesky (std::vector<T>& a, std::vector<T>& b,
+                  unsigned nrow, unsigned ncol, bool invert,
+                  double singular_threshold,
+                  std::vector<const char*>* names)
+{
+  if (nrow == 0)
+    return 0.0;
+
+  if (a.size() < nrow * nrow)
+    throw Error (InvalidState, "MEAL::Cholesky",
+                 "a.size()=%u < nrow*nrow=%u", a.size(), nrow*nrow);
+
+  if (b.size() < nrow * ncol)
+    throw Error (InvalidState, "MEAL::Cholesky",
+                 "b.size()=%u < nrow*ncol=%u", b.size(), nrow*ncol);
+
+  // L[j][k] * D[k] for the current row
+  std::vector<T> LD (nrow);
+
+  T log_abs_det_a = 0.0;
+
+  for (unsigned j=0; j < nrow; j++)
+  {
+    T* Lj = &a[j*nrow];
+
+    for (unsigned k=0; k < j; k++)
+      LD[k] = Lj[k] * a[k*nrow+k];
+
+    T d = Lj[j];
+    for (unsigned k=0; k < j; k++)
+      d -= Lj[k] * LD[k];
+
+    if (!(d > singular_threshold))
+    {
+      if (names)
+        std::cerr << "MEAL::Cholesky singular irow=" << j
+                  << " name=" << (*names)[j] << std::endl;
+
+      throw Error (InvalidState, "MEAL::Cholesky",
+                   "Singular Matrix.  irow=%u nrow=%u pivot=%le", j, nrow, d);
+    }
+
+    Lj[j] = d;
+    log_abs_det_a += std::log(d);
+
+    for (unsigned i=j+1; i < nrow; i++)
+    {
+      T* Li = &a[i*nrow];
+      T sum = Li[j];
+      for (unsigned k=0; k < j; k++)
+        sum -= Li[k] * LD[k];
+      Li[j] = sum / d;
+    }
+  }
+
+  // forward substitution: L y = b
+  for (unsigned i=1; i < nrow; i++)
+    for (unsigned k=0; k < i; k++)
+    {
+      T Lik = a[i*nrow+k];
+      for (unsigned m=0; m < ncol; m++)
+        b[i*ncol+m] -= Lik * b[k*ncol+m];
+    }
+
+  // diagonal: D z = y
+  for (unsigned i=0; i < nrow; i++)
+  {
+    T dinv = 1.0 / a[i*nrow+i];
+    for (unsigned m=0; m < ncol; m++)
+      b[i*ncol+m] *= dinv;
+  }
+
+  // back substitution: L^T x = z
+  for (unsigned i=nrow-1; i > 0; i--)
+    for (unsigned k=0; k < i; k++)
+    {
+      T Lik = a[i*nrow+k];
+      for (unsigned m=0; m < ncol; m++)
+        b[k*ncol+m] -= Lik * b[i*ncol+m];
+    }
+
+  if (!invert)
+    return log_abs_det_a;
+
+  /*
+    Compute inv(a) = inv(L)^T inv(D) inv(L), starting with inv(L),
+    which is unit lower triangular and is stored in the upper triangle
+    (transposed) so that the factor L remains available.
+  */
+  std::vector<T> Linv (nrow * nrow, 0.0);
+
+  for (unsigned j=0; j < nrow; j++)
+  {
+    Linv[j*nrow+j] = 1.0;
+    for (unsigned i=j+1; i < nrow; i++)
+    {
+      T sum = 0.0;
+      for (unsigned k=j; k < i; k++)
+        sum -= a[i*nrow+k] * Linv[k*nrow+j];
+      Linv[i*nrow+j] = sum;
+    }
+  }
+
+  std::vector<T> Dinv (nrow);
+  for (unsigned k=0; k < nrow; k++)
+    Dinv[k] = 1.0 / a[k*nrow+k];
+
+  for (unsigned i=0; i < nrow; i++)
+    for (unsigned j=0; j <= i; j++)
+    {
+      T sum = 0.0;
+      for (unsigned k=i; k < nrow; k++)
+        sum += Linv[k*nrow+i] * Dinv[k] * Linv[k*nrow+j];
+
+      a[i*nrow+j] = a[j*nrow+i] = sum;
+    }
+
+  return log_abs_det_a;
+}
+
+#endif
@@ -49,6 +49,14 @@ namespace MEAL {
     //! The transformation, \f$ J \f$
     Project<Complex2> transformation;
 
+  private:
+
+    //! Workspace: gradient of transformation
+    std::vector<Jones<double> > xform_grad;
+
+    //! Workspace: gradient of input
+    std::vector<Jones<double> > input_grad;
+
   };
 
 }
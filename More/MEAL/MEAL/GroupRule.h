@@ -113,6 +113,9 @@ namespace MEAL {
     //! The gradient
     std::vector<Result> gradient;
 
+    //! Workspace: the gradient of each component
+    std::vector<Result> comp_gradient;
+
     //! Initialize the result and gradient attributes
     void initialize ();
 
@@ -235,9 +238,6 @@ void MEAL::GroupRule<T>::calculate (Result& retval,
   // the result of each component
   Result comp_result;
 
-  // the gradient of each component
-  std::vector<Result> comp_gradient;
-
   // the pointer to the above array, if grad != 0
   std::vector<Result>* comp_gradient_ptr = 0;
   
@@ -12,6 +12,7 @@
 #define __MEAL_LeastSquares_H
 
 #include "Reference.h"
+#include <iostream>
 
 namespace MEAL {
 
@@ -80,6 +81,12 @@ namespace MEAL {
     //! Get the covariance matrix of the last fit
     void get_covariance (matrix& c) const { c = covariance; }
 
+    //! Write the state of the last fit in binary form
+    void unload_state (std::ostream&) const;
+
+    //! Read the state of a fit written by unload_state
+    void load_state (std::istream&);
+
   protected:
 
     //! The maximum number of iterations in during fit
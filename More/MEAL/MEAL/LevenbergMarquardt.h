@@ -12,6 +12,7 @@
 #define __Levenberg_Marquardt_h
 
 #include "MEAL/GaussJordan.h"
+#include "MEAL/Cholesky.h"
 #include "MEAL/Axis.h"
 #include "Estimate.h"
 #include "Error.h"
@@ -124,6 +125,14 @@ namespace MEAL
       decide when the curvature matrix is close to singular. */
     float singular_threshold = 1e-8;
 
+    //! Solve for the change in parameters by LDL^T decomposition
+    /*! By default, MEAL::GaussJordan is used.  When this flag is set,
+      the curvature matrix is copied into contiguous storage and the
+      normal equations are solved using MEAL::Cholesky, which requires
+      roughly one sixth of the floating point operations and computes
+      the matrix inverse only when the covariance matrix is requested. */
+    bool use_cholesky = false;
+
     //! print a report on the orthogonality of the curvature matrix on each iteration
     bool verify_orthogonality = false;
 
@@ -132,7 +141,7 @@ namespace MEAL
   protected:
 
     //! Inverts H*d=b, where: H=modified Hessian, d=delta, b=gradient
-    template <class Mt> void solve_delta (const Mt& model);
+    template <class Mt> void solve_delta (const Mt& model, bool invert = true);
     
     //! returns chi-squared and calculates the Hessian matrix and gradient
     template <class At, class Et, class Mt>
@@ -173,6 +182,12 @@ namespace MEAL
     //! The parameters of the current model
     std::vector<double> backup;
 
+    //! contiguous copy of the curvature matrix used by MEAL::Cholesky
+    std::vector<double> packed_alpha;
+
+    //! contiguous copy of the gradient used by MEAL::Cholesky
+    std::vector<double> packed_delta;
+
     static std::vector<std::vector<double> > null_arg;
   };
 
@@ -494,11 +509,13 @@ std::string MEAL::get_name (const Mt& model, unsigned iparam)
 
   \retval delta attribute
 
-  This method also uses the alpha attribute to temporarily hold alpha'
+  This method also uses the alpha attribute to temporarily hold alpha'.
+  If invert is true, alpha is replaced by its inverse on output;
+  otherwise, the contents of alpha are undefined when use_cholesky is set.
 */
 template <class Grad>
 template <class Mt>
-void MEAL::LevenbergMarquardt<Grad>::solve_delta (const Mt& model)
+void MEAL::LevenbergMarquardt<Grad>::solve_delta (const Mt& model, bool invert)
 {
   if (verbose > 2)
     std::cerr << "MEAL::LevenbergMarquardt<Grad>::solve_delta" << std::endl;
@@ -558,21 +575,52 @@ void MEAL::LevenbergMarquardt<Grad>::solve_delta (const Mt& model)
   if (verbose > 2)
     std::cerr << "MEAL::LevenbergMarquardt<Grad>::solve_delta for " << iinfit << " parameters" << std::endl;
 
-  //! curvature matrix
-  std::vector<std::vector<double> > temp_copy (alpha);
+  /* curvature matrix; a copy is required only for diagnostic output
+     because MEAL::Cholesky operates on a copy of alpha */
+  std::vector<std::vector<double> > temp_copy;
+
+  if (verify_orthogonality || (verbose > 0 && !use_cholesky))
+    temp_copy = alpha;
 
   if (verify_orthogonality)
     verify_orthogonal (temp_copy, model);
 
   try
   {
-    // invert Equation 15.5.14
-    log_det_alpha = MEAL::GaussJordan (alpha, delta, iinfit, singular_threshold, &name_ptrs);
+    if (use_cholesky)
+    {
+      packed_alpha.resize (iinfit * iinfit);
+      packed_delta.resize (iinfit);
+
+      for (unsigned i=0; i<iinfit; i++)
+      {
+        for (unsigned j=0; j<iinfit; j++)
+          packed_alpha[i*iinfit+j] = alpha[i][j];
+        packed_delta[i] = delta[i][0];
+      }
+
+      // solve Equation 15.5.14
+      log_det_alpha = MEAL::Cholesky (packed_alpha, packed_delta, iinfit, 1,
+                                      invert, singular_threshold, &name_ptrs);
+
+      for (unsigned i=0; i<iinfit; i++)
+      {
+        if (invert)
+          for (unsigned j=0; j<iinfit; j++)
+            alpha[i][j] = packed_alpha[i*iinfit+j];
+        delta[i][0] = packed_delta[i];
+      }
+    }
+    else
+    {
+      // invert Equation 15.5.14
+      log_det_alpha = MEAL::GaussJordan (alpha, delta, iinfit, singular_threshold, &name_ptrs);
+    }
   }
   catch (Error& error)
   {
     if (verbose > 0)
-      verify_orthogonal (temp_copy, model);
+      verify_orthogonal (use_cholesky ? alpha : temp_copy, model);
     throw error += "MEAL::LevenbergMarquardt<Grad>::solve_delta";
   }
 
@@ -611,7 +659,8 @@ float MEAL::LevenbergMarquardt<Grad>::iter
   if (verbose > 2)
     std::cerr << "MEAL::LevenbergMarquardt<Grad>::iter" << std::endl;
 
-  solve_delta (model);
+  // the inverse of the curvature matrix is not needed to take a step
+  solve_delta (model, false);
 
   // After call to solve_delta, delta contains required change in model
   // parameters.  Update the model.
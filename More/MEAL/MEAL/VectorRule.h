@@ -76,6 +76,9 @@ namespace MEAL {
     //! The models and their mappings
     std::vector< Project<T> > model;
 
+    //! Workspace: the gradient of the current component
+    std::vector<Result> comp_gradient;
+
     //! The current index in the array
     unsigned model_index;
 
@@ -236,9 +239,6 @@ void MEAL::VectorRule<T>::calculate (Result& result,
   if (nmodel == 0)
     throw Error (InvalidState, "MEAL::"+get_name()+"::calculate", "nmodel = 0");
 
-  // the gradient of each component
-  std::vector<Result> comp_gradient;
-
   // the pointer to the above array, if grad != 0
   std::vector<Result>* comp_gradient_ptr = 0;
 
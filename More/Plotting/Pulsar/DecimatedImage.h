@@ -0,0 +1,145 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/Plotting/Pulsar/DecimatedImage.h
+
+#ifndef __Pulsar_DecimatedImage_h
+#define __Pulsar_DecimatedImage_h
+
+#include <vector>
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Pulsar {
+
+  //! Reduces an image to the resolution of the output device
+  /*! The full-resolution image is filled row by row, using storage
+    that is retained between calls to resize, so that an image may be
+    redrawn without allocating memory.  The image is then reduced by
+    integer factors along each axis, so that no more than one image
+    cell is drawn per device pixel.  The reduced image may be cached
+    and redrawn until the key that describes the data changes. */
+  class DecimatedImage
+  {
+
+  public:
+
+    //! Methods of reducing a block of image cells to a single cell
+    enum Method
+    {
+      //! Draw every cell of the full-resolution image
+      None,
+      //! Draw the mean of each block
+      Mean,
+      //! Draw the extreme value (of greatest magnitude) in each block
+      MinMax
+    };
+
+    //! Default constructor
+    DecimatedImage ();
+
+    //! Set the method by name (none, mean, or minmax)
+    void set_method (const std::string&);
+    //! Get the name of the method
+    std::string get_method () const;
+
+    //! When set, cells equal to zero are ignored
+    void set_ignore_zero (bool flag) { ignore_zero = flag; }
+
+    //! Resize the full-resolution image, re-using existing storage
+    void resize (unsigned nx, unsigned ny);
+
+    //! Get the number of cells in each row of the full-resolution image
+    unsigned get_nx () const { return nx; }
+    //! Get the number of rows in the full-resolution image
+    unsigned get_ny () const { return ny; }
+
+    //! Return a pointer to the first cell of the full-resolution image
+    float* get_data () { return input.empty() ? 0 : &input[0]; }
+
+    //! Return a pointer to the specified row of the full-resolution image
+    float* get_row (unsigned iy) { return &input[iy * nx]; }
+
+    //! Reduce the full-resolution image by the specified factors
+    void decimate (unsigned x_factor, unsigned y_factor);
+
+    //! Get the reduced image
+    const float* get_image () const;
+
+    //! Get the number of cells in each row of the reduced image
+    unsigned get_image_nx () const { return image_nx; }
+    //! Get the number of rows in the reduced image
+    unsigned get_image_ny () const { return image_ny; }
+
+    //! Get the number of full-resolution cells per reduced cell along x
+    unsigned get_x_factor () const { return x_factor; }
+    //! Get the number of full-resolution rows per reduced row
+    unsigned get_y_factor () const { return y_factor; }
+
+    //! Return the factor by which ncell spanning npixel may be reduced
+    unsigned get_factor (unsigned ncell, float npixel) const;
+
+    //! Get the width and height of the current viewport in device pixels
+    static void get_viewport_pixels (float& width, float& height);
+
+    //! Incrementally computes the key that describes the image data
+    class Key
+    {
+    public:
+      Key () { value = 14695981039346656037ULL; }
+
+      //! Include nbyte bytes starting at data
+      void add (const void* data, size_t nbyte);
+
+      //! Include the bytes of x
+      template<typename T> void add (const T& x) { add (&x, sizeof(T)); }
+
+      uint64_t value;
+    };
+
+    //! Return true if the reduced image was computed from data with key
+    bool is_current (const Key& key) const
+    { return valid && key.value == current.value; }
+
+    //! Record the key of the data from which the image was computed
+    void set_current (const Key& key) { current = key; valid = true; }
+
+    //! Force the image to be recomputed when next drawn
+    void invalidate () { valid = false; }
+
+  protected:
+
+    //! The reduction method
+    Method method;
+
+    //! Ignore cells equal to zero
+    bool ignore_zero;
+
+    //! The full-resolution image
+    std::vector<float> input;
+    unsigned nx, ny;
+
+    //! The reduced image
+    std::vector<float> output;
+    unsigned image_nx, image_ny;
+    unsigned x_factor, y_factor;
+
+    //! Scratch space used to compute the reduced image
+    std::vector<float> other;
+    std::vector<unsigned> count;
+
+    //! The key of the data from which the reduced image was computed
+    Key current;
+    bool valid;
+
+  };
+
+}
+
+#endif
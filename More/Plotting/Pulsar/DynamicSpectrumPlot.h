@@ -13,6 +13,7 @@
 #include "Pulsar/TimeScale.h"
 #include "Pulsar/FrequencyScale.h"
 #include "Pulsar/Index.h"
+#include "Pulsar/DecimatedImage.h"
 
 #include "ColourMap.h"
 
@@ -67,6 +68,19 @@ namespace Pulsar {
     //! Return pointer to y scale
     FrequencyScale* get_y_scale () { return y_scale; }
 
+    //! Set the method used to reduce the image to the device resolution
+    void set_decimate (const std::string& m) { image.set_method (m); }
+    //! Get the method used to reduce the image to the device resolution
+    std::string get_decimate () const { return image.get_method (); }
+
+    //! Re-use the image drawn previously if the data are unchanged
+    void set_cache (bool flag) { cache = flag; image.invalidate (); }
+    //! Get the image cache flag
+    bool get_cache () const { return cache; }
+
+    //! Force the image to be recomputed after data are modified in place
+    void set_data_changed () { image.invalidate (); }
+
   protected:
 
     pgplot::ColourMap colour_map;
@@ -76,6 +90,20 @@ namespace Pulsar {
 
     bool zero_check;
 
+    //! The image, reduced to the resolution of the device
+    DecimatedImage image;
+
+    //! The range of the data in the image
+    float image_min, image_max;
+
+    //! Re-use the image drawn previously if the data are unchanged
+    /*! The image is considered unchanged if the same Archive, with the
+      same sub-integrations, weights, and amplitude arrays, is plotted
+      in the same frame with the same pol and method.  Amplitudes that
+      are modified in place, and changes to the options of derived
+      classes, are not detected; call set_data_changed after either. */
+    bool cache;
+
     Reference::To<TimeScale> x_scale;
     Reference::To<FrequencyScale> y_scale;
   };
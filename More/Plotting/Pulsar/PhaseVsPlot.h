@@ -12,6 +12,7 @@
 #define __Pulsar_PhaseVsPlot_h
 
 #include "Pulsar/PhasePlot.h"
+#include "Pulsar/DecimatedImage.h"
 #include "ColourBar.h"
 #include "ColourMap.h"
 
@@ -74,6 +75,19 @@ namespace Pulsar {
     //! Get the first and last row to plot
     std::pair<unsigned,unsigned> get_rows() const;
 
+    //! Set the method used to reduce the image to the device resolution
+    void set_decimate (const std::string& m) { image.set_method (m); }
+    //! Get the method used to reduce the image to the device resolution
+    std::string get_decimate () const { return image.get_method (); }
+
+    //! Re-use the image drawn previously if the data are unchanged
+    void set_cache (bool flag) { cache = flag; image.invalidate (); }
+    //! Get the image cache flag
+    bool get_cache () const { return cache; }
+
+    //! Force the image to be recomputed after data are modified in place
+    void set_data_changed () { image.invalidate (); }
+
   protected:
 
     PlotScale z_scale;
@@ -90,6 +104,19 @@ namespace Pulsar {
     //! The percentage of max to crop at
     float crop_value;
 
+    //! The image, reduced to the resolution of the device
+    DecimatedImage image;
+
+    //! The range of the visible data in the image
+    float image_min, image_max;
+
+    //! Re-use the image drawn previously if the data are unchanged
+    /*! The image is considered unchanged if the same Profile
+      instances, with the same weights and amplitude arrays, are
+      plotted in the same frame.  Amplitudes that are modified in
+      place are not detected; call set_data_changed after doing so. */
+    bool cache;
+
   };
 
 }
@@ -99,6 +99,31 @@ namespace Pulsar
     void search_2D (unsigned nalpha, unsigned nzeta);
     void search_1D (unsigned nzeta);
 
+    //! Set the number of threads used by search_2D
+    /*! Each thread fits a block of rows (values of alpha) of the grid
+      using an independent copy of the model. */
+    void set_nthread (unsigned n) { nthread = n; }
+    unsigned get_nthread () const { return nthread; }
+
+    //! Start each fit from the converged fit of its neighbour
+    /*! In each row of the grid searched by search_2D, the fit at each
+      zeta (or beta) starts from the values of the reference position
+      angle, magnetic meridian and linear polarization that minimized
+      chi-squared at the previous zeta.  The first fit in each row, and
+      any fit following one that failed, starts from the original guess.
+      Fewer iterations are required, but chi-squared may converge to a
+      different local minimum than it does from the original guess. */
+    void set_warm_start (bool flag) { warm_start = flag; }
+    bool get_warm_start () const { return warm_start; }
+
+    //! Set the number of times that search_2D refines the grid
+    /*! On each refinement, a 5x5 grid with half the spacing of the
+      previous grid is centred on the current minimum; the best fit is
+      updated if a smaller chi-squared is found.  Refinements are not
+      included in the chi-squared map. */
+    void set_refine (unsigned n) { refine = n; }
+    unsigned get_refine () const { return refine; }
+
     //! Evaluate the model at the specified pulse longitude (in radians)
     double evaluate (double phi_radians);
 
@@ -174,6 +199,31 @@ namespace Pulsar
 
     double max_L;
 
+    unsigned nthread;
+    bool warm_start;
+    unsigned refine;
+
+    //! The values of alpha and zeta (or beta) and the results of each fit
+    class SearchGrid;
+
+    //! The grid searched by search_rows
+    SearchGrid* grid;
+
+    //! Independent copies of the model used by search_rows
+    std::vector< Reference::To<ComplexRVMFit> > workers;
+
+    //! Return a copy of this that shares no model or data axis
+    ComplexRVMFit* search_clone () const;
+
+    //! Fit the model at each point in the grid, using nthread threads
+    void search (SearchGrid*);
+
+    //! Fit the model at each point in the ijob-th of njob blocks of rows
+    void search_rows (unsigned ijob, unsigned njob);
+
+    //! Fit the model at each point in the specified row of the grid
+    void search_row (SearchGrid*, unsigned irow);
+
     bool auto_detect_opm;
   };
 }
@@ -25,11 +25,22 @@ namespace Calibration
     //! Return a new, copy-constructed clone
     SolveMEAL* clone () const;
 
+  public:
+
+    //! Solve the normal equations by LDL^T decomposition
+    void set_use_cholesky (bool flag = true) { use_cholesky = flag; }
+
+    //! Return true if the normal equations are solved by LDL^T decomposition
+    bool get_use_cholesky () const { return use_cholesky; }
+
   protected:
 
     //! Solve the measurement equation using MEAL::LevenbergMarquardt
     void fit ();
 
+    //! Use MEAL::Cholesky instead of MEAL::GaussJordan
+    bool use_cholesky = false;
+
   };
 
 }
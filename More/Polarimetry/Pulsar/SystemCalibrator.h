@@ -210,6 +210,9 @@ namespace Pulsar
     //! Set the number of channels that may be simultaneously solved
     virtual void set_nthread (unsigned nthread);
 
+    //! Set the number of child processes among which channels are solved
+    virtual void set_nprocess (unsigned nprocess);
+
     //! Set the measurement equation configuration options
     virtual void set_equation_configuration (const std::vector<std::string>&);
 
@@ -550,6 +553,15 @@ namespace Pulsar
     //! Controls the number of channels that may be simultaneously solved
     BatchQueue queue;
 
+    //! Number of child processes among which channels are distributed
+    unsigned nprocess = 1;
+
+    //! Solve the specified channels in nprocess child processes
+    void solve_fork (const std::vector<unsigned>& channels);
+
+    //! Apply a solution received from a child process
+    bool solve_fork_receive (const std::string& record);
+
     //! Get the state of the prepared flag
     bool get_prepared () const;
 
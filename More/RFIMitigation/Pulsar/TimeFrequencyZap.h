@@ -114,6 +114,12 @@ namespace Pulsar {
       //! Get flag to recompute the statistic on each iteration
       bool get_recompute () const { return recompute; }
 
+      //! Set the number of threads used to compute the statistic
+      void set_nthread (unsigned n) { nthread = n; }
+
+      //! Get the number of threads used to compute the statistic
+      unsigned get_nthread () const { return nthread; }
+
       //! Set flag to print a one-line report
       void set_report (bool flag = true) { report = flag; }
 
@@ -230,6 +236,9 @@ namespace Pulsar {
     //! Print a report on stdout
     bool report;
 
+    //! Number of threads used to compute the statistic
+    unsigned nthread;
+
     //! Name of file to which statistics are printed on first iteration
     std::string filename;
 
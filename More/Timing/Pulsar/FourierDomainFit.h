@@ -50,6 +50,14 @@ namespace Pulsar {
     void set_iterations (int nit) { fit.set_mcmc_iterations(nit); }
     int get_iterations () const { return fit.get_mcmc_iterations(); }
 
+    //! Set number of MCMC chains, each computed by a separate thread
+    void set_chains (unsigned n) { fit.set_mcmc_chains(n); }
+    unsigned get_chains () const { return fit.get_mcmc_chains(); }
+
+    //! Print the time taken to compute each shift and its uncertainty
+    void set_report (bool flag = true) { report = flag; }
+    bool get_report () const { return report; }
+
     //! Set uncertainty calculation method
     void set_error_method (std::string m) { error_method=m; }
     std::string get_error_method () const { return error_method; }
@@ -67,6 +75,9 @@ namespace Pulsar {
     //! S/N ratio of last profile fit
     mutable double snr;
 
+    //! Print the time taken to compute each shift
+    bool report;
+
     //! The class that does the actual fit
     mutable ProfileShiftFit fit;
 
@@ -0,0 +1,102 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/More/Timing/Pulsar/StandardCache.h
+
+#ifndef __Pulsar_StandardCache_h
+#define __Pulsar_StandardCache_h
+
+#include "Pulsar/Archive.h"
+
+#include <string>
+#include <deque>
+#include <map>
+
+namespace Pulsar {
+
+  //! Stores the standards prepared for use by ArrivalTime
+  /*! Loading a standard, scrunching it to match the observation and
+    preparing it for the shift estimator can take longer than the
+    estimation of the arrival times; therefore, when many observations
+    are timed using the same template, each prepared standard is kept
+    in memory and reused by every matching observation.
+
+    The prepared standards are shared; the cache is not thread-safe. */
+  class StandardCache : public Reference::Able {
+
+  public:
+
+    //! Return the cache shared by all users in this process
+    static StandardCache* get_instance ();
+
+    //! Describes a standard and the observations for which it is prepared
+    class Key {
+
+    public:
+
+      //! Construct with the template filename and the form of the data
+      /*! The number of frequency channels is that of the prepared
+	standard, where zero means that it is not frequency scrunched;
+	the remaining attributes describe the observations that it
+	will be used to time. */
+      Key (const std::string& filename, unsigned nchan,
+	   unsigned nbin, unsigned npol, Signal::State state);
+
+      //! Ordering used by the map
+      bool operator < (const Key&) const;
+
+      //! Return a description of the key
+      std::string get_text () const;
+
+    private:
+
+      std::string filename;
+      unsigned nchan;
+      unsigned nbin;
+      unsigned npol;
+      Signal::State state;
+    };
+
+    //! Default constructor
+    StandardCache ();
+
+    //! Set the maximum number of standards kept in memory
+    void set_maximum_size (unsigned n) { maximum_size = n; }
+    unsigned get_maximum_size () const { return maximum_size; }
+
+    //! Return the standard stored under the key, or null if not found
+    Archive* find (const Key&);
+
+    //! Store the prepared standard under the key
+    void insert (const Key&, Archive*);
+
+    //! Remove all standards
+    void clear ();
+
+    //! Get the number of requests found in the cache
+    unsigned get_hits () const { return hits; }
+
+    //! Get the number of requests not found in the cache
+    unsigned get_misses () const { return misses; }
+
+  protected:
+
+    //! Prepared standards, indexed by key
+    std::map< Key, Reference::To<Archive> > standards;
+
+    //! The order in which standards were inserted
+    std::deque< Key > order;
+
+    unsigned maximum_size;
+    unsigned hits;
+    unsigned misses;
+  };
+
+}
+
+#endif
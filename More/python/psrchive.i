@@ -1,4 +1,7 @@
-%module psrchive
+// threads="1" enables the %thread feature, which releases the Python
+// global interpreter lock while the selected C++ methods are running
+%module(threads="1") psrchive
+%nothread;
 
 %rename(Archive_Extension) Pulsar::Archive::Extension;
 %rename(Integration_Extension) Pulsar::Integration::Extension;
@@ -131,6 +134,25 @@ using namespace std;
 %newobject Pulsar::Predictor::clone;
 %newobject as_psrfits;
 
+// Release the global interpreter lock during the following methods,
+// so that other Python threads may run while they process the data
+%thread Pulsar::Archive::load;
+%thread Pulsar::Archive::unload;
+%thread Pulsar::Archive::bscrunch;
+%thread Pulsar::Archive::pscrunch;
+%thread Pulsar::Archive::fscrunch;
+%thread Pulsar::Archive::tscrunch;
+%thread Pulsar::Archive::bscrunch_to_nbin;
+%thread Pulsar::Archive::fscrunch_to_nchan;
+%thread Pulsar::Archive::tscrunch_to_nsub;
+%thread Pulsar::Archive::centre;
+%thread Pulsar::Archive::centre_max_bin;
+%thread Pulsar::Archive::dedisperse;
+%thread Pulsar::Archive::defaraday;
+%thread Pulsar::Archive::remove_baseline;
+%thread Pulsar::Archive::convert_state;
+%thread Pulsar::Archive::dededisperse;
+
 // Track any pointers handed off to python with a global list
 // of Reference::To objects.  Prevents the C++ routines from
 // prematurely destroying objects by effectively making python
@@ -158,6 +180,70 @@ void pointer_tracker_remove(Reference::Able *ptr)
       it++;
   }
 }
+
+// Return true if the profiles of subint are stored one after the other,
+// in the order of a C-contiguous (npol, nchan, nbin) array, starting at
+// the address pointed to by next (if not null); next is updated
+bool contiguous_amps (Pulsar::Integration* subint, float*& next)
+{
+  unsigned nbin = subint->get_nbin();
+  for (unsigned ipol=0; ipol < subint->get_npol(); ipol++)
+    for (unsigned ichan=0; ichan < subint->get_nchan(); ichan++)
+    {
+      float* amps = subint->get_Profile(ipol, ichan)->get_amps();
+      if (!amps || (next && amps != next))
+        return false;
+      next = amps + nbin;
+    }
+  return true;
+}
+
+// Return a numpy __array_interface__ dictionary that describes the
+// amplitudes starting at data, or None if data is null
+PyObject* array_interface (float* data, const std::vector<npy_intp>& shape)
+{
+  if (!data)
+    Py_RETURN_NONE;
+
+  // native byte order
+  const int one = 1;
+  const char* typestr = *reinterpret_cast<const char*>(&one) ? "<f4" : ">f4";
+
+  PyObject* dims = PyTuple_New (shape.size());
+  for (unsigned i=0; i < shape.size(); i++)
+    PyTuple_SetItem (dims, i, PyLong_FromSsize_t (shape[i]));
+
+  PyObject* result = Py_BuildValue ("{s:N,s:s,s:(N,O),s:i}",
+                                    "shape", dims,
+                                    "typestr", typestr,
+                                    "data", PyLong_FromVoidPtr (data), Py_False,
+                                    "version", 3);
+  return result;
+}
+
+// Return a C-contiguous float array that holds the data in obj, after
+// verifying that its shape matches the expected shape
+PyArrayObject* float_array (PyObject* obj, const std::vector<npy_intp>& shape)
+{
+  PyArrayObject* arr = (PyArrayObject*)
+    PyArray_FROM_OTF (obj, NPY_FLOAT, NPY_ARRAY_IN_ARRAY);
+
+  if (!arr)
+    throw Error (InvalidParam, "set_data",
+                 "cannot convert argument to a float32 array");
+
+  bool match = PyArray_NDIM(arr) == (int) shape.size();
+  for (unsigned i=0; match && i < shape.size(); i++)
+    match = PyArray_DIM(arr, i) == shape[i];
+
+  if (!match)
+  {
+    Py_DECREF (arr);
+    throw Error (InvalidParam, "set_data", "array shape does not match data");
+  }
+
+  return arr;
+}
 %}
 
 %ignore Pulsar::FrontendCorrection::new_Extension() const;
@@ -471,7 +557,7 @@ Pulsar::Archive* Archive_load (const std::string& name)
         ndims[0] = self->get_npol();
         ndims[1] = self->get_nchan();
         ndims[2] = self->get_nbin();
-        arr = (PyArrayObject *)PyArray_SimpleNew(4, ndims, NPY_FLOAT);
+        arr = (PyArrayObject *)PyArray_SimpleNew(3, ndims, NPY_FLOAT);
         for (int jj = 0 ; jj < ndims[0] ; jj++)
             for (int kk = 0 ; kk < ndims[1] ; kk++)
                 memcpy((char*)PSRCHIVE_PyArray_DATA(arr) + sizeof(float) * 
@@ -481,6 +567,55 @@ Pulsar::Archive* Archive_load (const std::string& name)
         return (PyObject *)arr;
     }
 
+    // Copy all of the data from a numpy array with shape (npol, nchan, nbin)
+    void set_data(PyObject *data)
+    {
+        std::vector<npy_intp> shape (3);
+        shape[0] = self->get_npol();
+        shape[1] = self->get_nchan();
+        shape[2] = self->get_nbin();
+
+        PyArrayObject* arr = float_array (data, shape);
+        const float* base = reinterpret_cast<float*>(PSRCHIVE_PyArray_DATA(arr));
+
+        for (npy_intp jj = 0 ; jj < shape[0] ; jj++)
+            for (npy_intp kk = 0 ; kk < shape[1] ; kk++)
+                self->get_Profile(jj, kk)->set_amps
+                    (base + shape[2] * (kk + shape[1] * jj));
+
+        Py_DECREF (arr);
+    }
+
+    // Describe the data if the profiles are stored contiguously; else None
+    PyObject *_array_interface()
+    {
+        std::vector<npy_intp> shape (3);
+        shape[0] = self->get_npol();
+        shape[1] = self->get_nchan();
+        shape[2] = self->get_nbin();
+
+        float* next = 0;
+        if (shape[0] * shape[1] * shape[2] == 0 || !contiguous_amps (self, next))
+            return array_interface (0, shape);
+
+        return array_interface (self->get_Profile(0,0)->get_amps(), shape);
+    }
+
+    %pythoncode %{
+@property
+def __array_interface__(self):
+    """numpy view of the data, if the profiles are stored contiguously"""
+    interface = self._array_interface()
+    if interface is None:
+        raise AttributeError("profile amplitudes are not stored contiguously")
+    return interface
+
+def __array__(self, dtype=None, copy=None):
+    """numpy copy of the data, used when a view is not possible"""
+    data = self.get_data()
+    return data if dtype is None else data.astype(dtype)
+%}
+
     // Interface to Pointing
     double get_telescope_zenith() {
         Pulsar::Pointing *p = self->get<Pulsar::Pointing>();
@@ -833,6 +968,64 @@ def rotate_phase(self,phase): return self._rotate_phase_swig(phase)
         return (PyObject *)arr;
     }
 
+    // Copy all of the data from a numpy array with shape
+    // (nsubint, npol, nchan, nbin)
+    void set_data(PyObject *data)
+    {
+        std::vector<npy_intp> shape (4);
+        shape[0] = self->get_nsubint();
+        shape[1] = self->get_npol();
+        shape[2] = self->get_nchan();
+        shape[3] = self->get_nbin();
+
+        PyArrayObject* arr = float_array (data, shape);
+        const float* base = reinterpret_cast<float*>(PSRCHIVE_PyArray_DATA(arr));
+
+        for (npy_intp ii = 0 ; ii < shape[0] ; ii++)
+            for (npy_intp jj = 0 ; jj < shape[1] ; jj++)
+                for (npy_intp kk = 0 ; kk < shape[2] ; kk++)
+                    self->get_Profile(ii, jj, kk)->set_amps
+                        (base + shape[3] * (kk + shape[2] * (jj + shape[1] * ii)));
+
+        Py_DECREF (arr);
+    }
+
+    // Describe the data if the profiles are stored contiguously; else None
+    PyObject *_array_interface()
+    {
+        std::vector<npy_intp> shape (4);
+        shape[0] = self->get_nsubint();
+        shape[1] = self->get_npol();
+        shape[2] = self->get_nchan();
+        shape[3] = self->get_nbin();
+
+        bool contiguous = shape[0] * shape[1] * shape[2] * shape[3] > 0;
+
+        float* next = 0;
+        for (npy_intp ii = 0 ; contiguous && ii < shape[0] ; ii++)
+            contiguous = contiguous_amps (self->get_Integration(ii), next);
+
+        if (!contiguous)
+            return array_interface (0, shape);
+
+        return array_interface (self->get_Profile(0,0,0)->get_amps(), shape);
+    }
+
+    %pythoncode %{
+@property
+def __array_interface__(self):
+    """numpy view of the data, if the profiles are stored contiguously"""
+    interface = self._array_interface()
+    if interface is None:
+        raise AttributeError("profile amplitudes are not stored contiguously")
+    return interface
+
+def __array__(self, dtype=None, copy=None):
+    """numpy copy of the data, used when a view is not possible"""
+    data = self.get_data()
+    return data if dtype is None else data.astype(dtype)
+%}
+
     // Return a copy of the profile amplitudes, multiplied by the profile weights, as a numpy array
     PyObject *get_weighted_data()
     {
@@ -91,6 +91,12 @@ namespace FTransform {
   //! Use the Fourier transform to cyclically shift the elements in array
   void shift (unsigned npts, float* arr, double shift);
 
+  //! Compute the phasors used to cyclically shift an array of npts elements
+  void shift_phasors (unsigned npts, double shift, std::vector<double>& phasors);
+
+  //! Cyclically shift the elements in array using pre-computed phasors
+  void shift (unsigned npts, float* arr, const std::vector<double>& phasors);
+
   //! Use the Fourier transform to compute the derivative of data
   void derivative (unsigned npts, float* data);
 
@@ -0,0 +1,102 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Util/genutil/Bootstrap.h
+
+#ifndef __Bootstrap_h
+#define __Bootstrap_h
+
+#include "ReferenceTo.h"
+#include "Estimate.h"
+#include <vector>
+
+//! Estimates the uncertainty of a model by fitting it to resampled data
+/*! The model is first fit to the data; the normalized residuals of
+  this fit are then resampled with replacement and added to the model
+  to produce each simulated data set, to which the model is fit again.
+  The variance of the model over all simulated data sets is the
+  bootstrap estimate of its uncertainty.
+
+  Each sample draws the indeces of the resampled residuals from its
+  own random number generator, seeded by the sample index; therefore,
+  the result does not depend on the number of threads. */
+class Bootstrap : public Reference::Able
+{
+public:
+
+  //! Fits a model to the data and evaluates it at each datum
+  class Fit : public Reference::Able
+  {
+  public:
+
+    //! Return a new instance, used by another thread
+    virtual Fit* clone () const = 0;
+
+    //! Fit the model to the data and evaluate it at each datum
+    virtual void fit (const std::vector< Estimate<double> >& data,
+		      std::vector<double>& model) = 0;
+  };
+
+  //! Default constructor
+  Bootstrap ();
+
+  //! Destructor
+  ~Bootstrap ();
+
+  //! Set the maximum number of simulated data sets
+  void set_nsample (unsigned n) { nsample = n; }
+  unsigned get_nsample () const { return nsample; }
+
+  //! Set the number of threads used to fit simulated data sets
+  void set_nthread (unsigned n) { nthread = n; }
+  unsigned get_nthread () const { return nthread; }
+
+  //! Set the seed of the random number generators
+  void set_seed (unsigned long s) { seed = s; }
+  unsigned long get_seed () const { return seed; }
+
+  //! Resample Gaussian noise, instead of the residuals of the fit
+  void set_parametric (bool flag = true) { parametric = flag; }
+  bool get_parametric () const { return parametric; }
+
+  //! Stop when the fractional change in the mean variance is less than this
+  /*! The convergence of the variance is tested after each batch of
+    simulated data sets; zero disables early stopping. */
+  void set_tolerance (double t) { tolerance = t; }
+  double get_tolerance () const { return tolerance; }
+
+  //! Set the number of simulated data sets between convergence tests
+  void set_batch_size (unsigned n) { batch_size = n; }
+  unsigned get_batch_size () const { return batch_size; }
+
+  //! Get the number of simulated data sets used by the last call
+  unsigned get_nsample_used () const { return nsample_used; }
+
+  //! Replace the data with the model and its bootstrap uncertainty
+  void get_uncertainty (Fit* fit, std::vector< Estimate<double> >& data);
+
+protected:
+
+  unsigned nsample;
+  unsigned nthread;
+  unsigned long seed;
+  bool parametric;
+  double tolerance;
+  unsigned batch_size;
+  unsigned nsample_used;
+
+private:
+
+  class Samples;
+  Samples* samples;
+
+  //! Fit a block of simulated data sets in the current batch
+  void simulate (unsigned ijob, unsigned njob);
+};
+
+#endif
@@ -11,6 +11,8 @@
 #ifndef __SmoothingSpline_h
 #define __SmoothingSpline_h
 
+#include "ReferenceAble.h"
+#include "Bootstrap.h"
 #include "Estimate.h"
 #include <vector>
 
@@ -90,19 +92,38 @@ public:
   https://www.jstor.org/stable/2984885
 */
 
-class CrossValidatedSmoothing
+class CrossValidatedSmoothing : public Reference::Able
 {
   bool logarithmic;             // linearly space smoothing factors on logarithmic scale
   unsigned ntrial;              // number of trial smoothing factors
   unsigned npartition;          // m=40 in Clark (1977)
   double validation_fraction;   // 0.1 in Clark (1977)
   SmoothingSpline* spline;      // the spline implementation
-  
+  unsigned nthread;             // number of threads used to evaluate trials
+
+  class Trials;
+  Trials* trials;
+
+  //! Compute the mean goodness-of-fit of every trial using nthread threads
+  void get_mean_gof (const std::vector< double >& data_x,
+		     const std::vector< Estimate<double> >& data_y,
+		     const std::vector< double >& nfree,
+		     std::vector< double >& mean_gof);
+
+  //! Fit the trial and partition pairs in the specified block
+  void get_gof_block (unsigned ijob, unsigned njob);
+
 public:
 
   CrossValidatedSmoothing ();
 
   void set_spline (SmoothingSpline* _spline) { spline = _spline; }
+
+  //! Set the number of threads used to evaluate the trial smoothing factors
+  /*! Each thread fits a copy of the spline; the selected number of
+    free parameters is identical to that selected using one thread. */
+  void set_nthread (unsigned n) { nthread = n; }
+  unsigned get_nthread () const { return nthread; }
   
   //! Fit spline to data using current configuration
   void fit ( std::vector< double >& data_x,
@@ -117,11 +138,13 @@ public:
 
 };
 
-class BootstrapUncertainty
+//! Computes bootstrap error bars of a smoothing spline
+class BootstrapUncertainty : public Bootstrap
 {
-  unsigned nsample;
   SmoothingSpline* spline;      // the spline implementation
-  
+
+  class SplineFit;
+
 public:
 
   BootstrapUncertainty ();
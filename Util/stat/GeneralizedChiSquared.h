@@ -15,21 +15,69 @@ namespace BinaryStatistics
 {
   //! Computes the generalized squared interpoint distance between vectors
   /*! If one of the vectors is the mean of the distribution, than this 
-    distance is equivalent to the square of the Mahalanobis distance. */
+    distance is equivalent to the square of the Mahalanobis distance.
+
+    The covariance matrix is represented by its leading eigenvectors
+    and eigenvalues plus, optionally, a diagonal term equal to the
+    variance of the noise in the space orthogonal to the eigenvectors.
+    After the eigenvectors and eigenvalues are set, call update. */
   class GeneralizedChiSquared : public BinaryStatistic
   {
     bool robust_linear_fit;
     double outlier_threshold;
     double max_zap_fraction;
+    double noise_variance;
 
     std::vector<double> residual;
 
+    //! The eigenvectors, stored as contiguous row vectors
+    std::vector<double> basis;
+
+    //! The sum of the elements of each eigenvector
+    std::vector<double> basis_sum;
+
+    //! The number of elements in each eigenvector
+    unsigned basis_ndat;
+
+    //! The most recently projected vector and its principal components
+    class Projection
+    {
+    public:
+      std::vector<double> data;
+      std::vector<double> pc;
+    };
+
+    //! The last projection of each argument to get
+    Projection cache[2];
+
+    //! Return the principal components of data, re-using cache if possible
+    const std::vector<double>& project (const std::vector<double>& data,
+                                        Projection& cache);
+
+    //! Compute the principal components of nvec vectors at once
+    void project (std::vector<double>* pc,
+                  const std::vector<double>* data, unsigned nvec);
+
+    //! Compute the statistic, given the principal components of each vector
+    double evaluate (const std::vector<double>& pc1,
+                     const std::vector<double>& pc2,
+                     const std::vector<double>& dat1,
+                     const std::vector<double>& dat2);
+
   public:
 
     GeneralizedChiSquared ();
 
     double get (const std::vector<double>&, const std::vector<double>&);
 
+    //! Compare each element of data1 with data2
+    /*! The principal components of data2 are computed only once, and
+      those of data1 are computed in blocks that share each pass over
+      the eigenvectors. */
+    void get (const std::vector< std::vector<double> >& data1,
+              const std::vector<double>& data2,
+              std::vector<double>& result);
+
     //! Return the residual
     const std::vector<double>& get_residual () const { return residual; }
     
@@ -37,7 +85,15 @@ namespace BinaryStatistics
 
     //! Return the number of eigenvalue/vector pairs
     unsigned get_neigen () const { return eigenvalues.size(); }
-    
+
+    //! Set the noise variance in the space orthogonal to the eigenvectors
+    /*! If zero (the default) only the principal components are compared */
+    void set_noise_variance (double var) { noise_variance = var; }
+    double get_noise_variance () const { return noise_variance; }
+
+    //! Update cached quantities after the eigenvectors have been set
+    void update ();
+
     ndArray<2,double> eigenvectors;
     ndArray<1,double> eigenvalues;
     
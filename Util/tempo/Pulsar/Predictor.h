@@ -16,6 +16,7 @@
 #include "MJD.h"
 #include "Configuration.h"
 
+#include <vector>
 #include <stdio.h>
 
 namespace Pulsar {
@@ -43,6 +44,9 @@ namespace Pulsar {
     //! Policy for creating new predictors
     static Configuration::Parameter<Policy>& get_policy ();
 
+    //! Number of threads used to compute the phase at multiple epochs
+    static Configuration::Parameter<unsigned>& get_nthread ();
+
     //! Verbosity flag
     static bool verbose;
 
@@ -71,6 +75,9 @@ namespace Pulsar {
     //! Return the phase, given the epoch
     virtual Phase phase (const MJD& t) const = 0;
 
+    //! Return the phase at each of the epochs
+    virtual std::vector<Phase> phase (const std::vector<MJD>& epochs) const;
+
     //! Return the epoch, given the phase and, optionally, a first guess
     virtual MJD iphase (const Phase& phase, const MJD* guess = 0) const = 0;
 
@@ -0,0 +1,120 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Util/tempo/Pulsar/PredictorCache.h
+
+#ifndef __PulsarPredictorCache_h
+#define __PulsarPredictorCache_h
+
+#include "Reference.h"
+#include "Configuration.h"
+#include "tostring.h"
+
+#include <string>
+#include <deque>
+#include <map>
+
+namespace Pulsar {
+
+  class Predictor;
+  class Parameters;
+
+  //! Stores the predictors generated in response to identical requests
+  /*! Each predictor is indexed by a digest of the text of the
+    parameters and of the request made of the generator (site,
+    frequency range, time span, number of coefficients, etc.).
+    Predictors are kept in memory and, if a directory is configured,
+    on disk; therefore, identical requests made by the same or later
+    processes do not need to run tempo or tempo2 again. */
+  class PredictorCache : public Reference::Able {
+
+  public:
+
+    //! Maximum number of predictors kept in memory (zero disables caching)
+    static Configuration::Parameter<unsigned>& get_maximum_size ();
+
+    //! Directory in which predictors are stored (empty disables disk cache)
+    static Configuration::Parameter<std::string>& get_directory ();
+
+    //! Return the cache shared by all generators
+    static PredictorCache* get_instance ();
+
+    //! Describes a request made of a generator
+    class Key {
+
+    public:
+
+      //! Construct with the type of generator and the parameters
+      Key (const std::string& generator, const Parameters*);
+
+      //! Add an attribute of the request
+      void add (const std::string& name, const std::string& value);
+
+      //! Add a text attribute of the request
+      void add (const std::string& name, const char* value)
+      { add (name, std::string (value)); }
+
+      //! Add a numerical attribute of the request
+      template<typename T>
+      void add (const std::string& name, const T& value)
+      { add (name, tostring (value, 20)); }
+
+      //! Return the text that describes the request
+      const std::string& get_text () const { return text; }
+
+      //! Return the hexadecimal digest of the text
+      std::string get_digest () const;
+
+    private:
+
+      std::string text;
+    };
+
+    //! Default constructor
+    PredictorCache ();
+
+    //! Return true if a predictor is stored for the key
+    /*! If a predictor is found in memory, a copy is returned via
+      result; otherwise, if one is found on disk, it is loaded by
+      instance, which is returned via result. */
+    bool find (const Key&, Predictor* instance, Reference::To<Predictor>& result);
+
+    //! Store a copy of the predictor under the key
+    void insert (const Key&, const Predictor*);
+
+    //! Get the number of requests found in memory
+    unsigned get_memory_hits () const { return memory_hits; }
+
+    //! Get the number of requests found on disk
+    unsigned get_disk_hits () const { return disk_hits; }
+
+    //! Get the number of requests not found
+    unsigned get_misses () const { return misses; }
+
+  protected:
+
+    //! Predictors in memory, indexed by the text of the request
+    std::map< std::string, Reference::To<const Predictor> > memory;
+
+    //! The order in which predictors were added to memory
+    std::deque< std::string > order;
+
+    //! Add to memory, removing the oldest entries as required
+    void remember (const std::string& text, const Predictor*);
+
+    //! Return the name of the file in which the predictor is stored
+    std::string get_filename (const Key&) const;
+
+    unsigned memory_hits;
+    unsigned disk_hits;
+    unsigned misses;
+  };
+
+}
+
+#endif
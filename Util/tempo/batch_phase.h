@@ -0,0 +1,115 @@
+//-*-C++-*-
+/***************************************************************************
+ *
+ *   Copyright (C) 2026 by Willem van Straten
+ *   Licensed under the Academic Free License version 2.1
+ *
+ ***************************************************************************/
+
+// psrchive/Util/tempo/batch_phase.h
+
+#ifndef __P_batch_phase_h
+#define __P_batch_phase_h
+
+#include "BatchQueue.h"
+#include "MJD.h"
+#include "Phase.h"
+
+#include <vector>
+
+namespace Pulsar {
+
+  //! Return the indices of the epochs sorted in ascending order
+  void sort_epochs (std::vector<unsigned>& index,
+                    const std::vector<MJD>& epochs);
+
+  //! Execute and delete each job, running up to nthread at one time
+  void execute (std::vector<BatchQueue::Job*>& jobs, unsigned nthread);
+
+  //! Minimum number of epochs evaluated by each thread
+  extern unsigned batch_phase_minimum;
+
+  //! Computes the phase at a contiguous range of epochs
+  template<typename S>
+  class BatchPhase : public BatchQueue::Job
+  {
+  public:
+
+    const std::vector<MJD>* epochs;
+    const std::vector<const S*>* segments;
+    std::vector<Phase>* phases;
+    unsigned start;
+    unsigned end;
+
+    void execute ()
+    {
+      for (unsigned i=start; i < end; i++)
+        (*phases)[i] = (*segments)[i]->phase( (*epochs)[i] );
+    }
+  };
+
+  //! Compute the phase at each of the epochs
+
+  /*! This template function computes the phase at each epoch by first
+    finding the segment (e.g. polynomial) that spans each epoch, in
+    order of increasing epoch, and then evaluating the segments.  The
+    evaluation is divided among up to nthread threads.
+
+    This function requires class S and class L to implement the
+    following interfaces:
+
+    class S {
+    public:
+      Phase phase (const MJD&) const;
+    };
+
+    class L {
+    public:
+      const S* operator () (const MJD&);
+    };
+
+    Because the epochs are visited in ascending order, class L can
+    retain the last segment found and begin its search from there.
+    L is called from a single thread and may throw an exception if
+    no segment spans the epoch.
+  */
+  template<typename S, typename L>
+  void batch_phase (std::vector<Phase>& phases,
+                    const std::vector<MJD>& epochs,
+                    L& lookup, unsigned nthread)
+  {
+    unsigned ndat = epochs.size();
+
+    std::vector<unsigned> index;
+    sort_epochs (index, epochs);
+
+    std::vector<const S*> segments (ndat);
+    for (unsigned i=0; i < ndat; i++)
+      segments[index[i]] = lookup (epochs[index[i]]);
+
+    phases.resize (ndat);
+
+    unsigned njob = ndat / batch_phase_minimum;
+    if (njob > nthread)
+      njob = nthread;
+    if (njob < 1)
+      njob = 1;
+
+    std::vector<BatchQueue::Job*> jobs (njob);
+    for (unsigned ijob=0; ijob < njob; ijob++)
+    {
+      BatchPhase<S>* job = new BatchPhase<S>;
+      job->epochs = &epochs;
+      job->segments = &segments;
+      job->phases = &phases;
+      job->start = (ijob * ndat) / njob;
+      job->end = ((ijob+1) * ndat) / njob;
+      jobs[ijob] = job;
+    }
+
+    execute (jobs, njob);
+  }
+
+}
+
+#endif
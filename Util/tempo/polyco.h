@@ -234,6 +234,9 @@ public:
   Pulsar::Phase phase (const MJD& t) const
   { return best(t).phase(t); }
 
+  //! Return the phase at each of the epochs
+  std::vector<Pulsar::Phase> phase (const std::vector<MJD>& epochs) const;
+
   //! Return the phase plus the dispersion delay
   Pulsar::Phase phase (const MJD& t, long double MHz) const
   { const polynomial& b = best(t); return b.phase(t) + b.dispersion(t,MHz); }
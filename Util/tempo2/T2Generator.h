@@ -64,6 +64,9 @@ namespace Tempo2 {
     //! Name of file containing list of Tempo2 keywords
     static Configuration::Parameter<std::string>& get_keyword_filename();
 
+    //! Call the tempo2 library instead of running tempo2, if available
+    static Configuration::Parameter<bool>& get_in_process();
+
   private:
 
     //! The parameters used to generate the predictor
@@ -77,6 +80,14 @@ namespace Tempo2 {
     //! length of each segment in days
     long double segment_length;
 
+    //! Run tempo2 and load the predictor that it generates
+    void run_tempo2 (Predictor*, const std::string& parfile,
+		     long double use_epoch1, long double use_epoch2) const;
+
+    //! Construct the predictor using the tempo2 library
+    void construct (Predictor*, const std::string& parfile,
+		    long double use_epoch1, long double use_epoch2) const;
+
     template<typename T> void work_around_tempo2_tzr_bug (T& psr) const;
   };
 
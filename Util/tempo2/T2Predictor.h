@@ -84,6 +84,9 @@ namespace Tempo2 {
     //! Return the phase, given the epoch
     Pulsar::Phase phase (const MJD& t) const;
 
+    //! Return the phase at each of the epochs
+    std::vector<Pulsar::Phase> phase (const std::vector<MJD>& epochs) const;
+
     //! Return the epoch, given the phase
     MJD iphase (const Pulsar::Phase& phase, const MJD* guess) const;
 
@@ -257,14 +257,19 @@ c
      &eps)
       dimension x(n), y(ny, k), wx(n), wy(k), c(nc, k), wk(n + (6 * ((n
      & * m) + 1)))
-      save el, nm1, m2
+c
+c***  PSRCHIVE: the values saved for iterative mode (MD.lt.0) are kept
+c***  separately from the local copies used in the computation, so
+c***  that concurrent calls with MD.gt.0 do not share any state
+c
+      save els, nm1s, m2s
 c
 c***  Parameter check and work array initialization
 c
 c***  Check on mode parameter
-      data m2 / 0 /
-      data nm1 / 0 /
-      data el / 0d0 /
+      data m2s / 0 /
+      data nm1s / 0 /
+      data els / 0d0 /
       ier = 0
       if (((((iabs(md) .gt. 4) .or. (md .eq. 0)) .or. ((iabs(md) .eq. 1)
      & .and. (val .lt. zero))) .or. ((iabs(md) .eq. 3) .and. (val .lt. 
@@ -278,7 +283,11 @@ c***  Check on M and N
       if (md .gt. 0) then
       m2 = 2 * m
       nm1 = n - 1
+      m2s = m2
+      nm1s = nm1
       else
+      m2 = m2s
+      nm1 = nm1s
       if ((m2 .ne. (2 * m)) .or. (nm1 .ne. (n - 1))) then
 cM or N modified since previous call           
       ier = 3
@@ -323,6 +332,9 @@ cDesign matrix    WE ( -M:M  ,N)
       call prep(m, n, x, wx, wk(iwe), el)
 cL1-norms ratio (SAVEd upon RETURN)          
       el = el / r1
+      els = el
+      else
+      el = els
       end if
 c***     Prior given value for p
       if (iabs(md) .ne. 1) goto 20
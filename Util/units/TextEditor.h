@@ -42,6 +42,9 @@ class TextEditor : public Reference::Able
   void remove_extensions (const std::string& str)
   { standard_separation (extensions_to_remove, str); }
 
+  //! Get the commands to be executed
+  const std::vector<std::string>& get_commands () const { return commands; }
+
   //! Return true if the process method will modify the archive
   bool will_modify () const;
 
@@ -14,6 +14,7 @@
 #include "TextIndex.h"
 #include "Functor.h"
 #include <stack>
+#include <vector>
 
 //! Loop through ranges of indeces ascertained by a TextInterface
 class TextLoop : public Reference::Able 
@@ -38,6 +39,12 @@ public:
   //! Retrieve the index state
   std::string get_index_state () const;
 
+  //! Retrieve the index commands that define the current state
+  /*! Processing these commands in order restores the current state of
+    the container, e.g. in the interface to a copy of the container */
+  const std::vector<std::string>& get_index_commands () const
+  { return index_commands; }
+
 protected:
 
   //! The indeces over which to loop
@@ -52,6 +59,9 @@ protected:
 
   //! Current state of each index
   std::string index_state;
+
+  //! Commands that set the current state of each index
+  std::vector<std::string> index_commands;
 };
 
 #endif
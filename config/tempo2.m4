@@ -8,6 +8,7 @@
 # TEMPO2_LIBS   - autoconfig variable with flags required for linking
 # HAVE_TEMPO2   - automake conditional
 # HAVE_TEMPO2   - pre-processor macro in config.h
+# HAVE_TEMPO2_LIB - pre-processor macro in config.h
 #
 # This macro tries to link a test program, using 
 #
@@ -15,6 +16,11 @@
 #
 # Notice that the environment variable TEMPO2 is required.
 #
+# If the Predictor library is found, this macro also tries to link
+# with the tempo2 library (-ltempo2), which enables the in-process
+# generation of predictors; if successful, HAVE_TEMPO2_LIB is defined
+# and -ltempo2 is added to TEMPO2_LIBS.
+#
 # ----------------------------------------------------------
 AC_DEFUN([SWIN_LIB_TEMPO2],
 [
@@ -39,6 +45,24 @@ AC_DEFUN([SWIN_LIB_TEMPO2],
 
   AC_MSG_RESULT($have_tempo2)
 
+  have_tempo2_lib=no
+
+  if test x"$have_tempo2" = xyes; then
+
+    AC_MSG_CHECKING([for TEMPO2 library])
+
+    TEMPO2_LIB_LIBS="-L$TEMPO2/lib -ltempo2 $TEMPO2_LIBS"
+    LIBS="$ac_save_LIBS $TEMPO2_LIB_LIBS"
+
+    AC_TRY_LINK([#include "tempo2.h"],
+                [pulsar* psr = 0; initialise (psr, 1); destroyOne (psr);
+                 ChebyModelSet_Construct (0, psr, "", 0, 0, 0, 0, 0, 0, 1, 1);],
+                have_tempo2_lib=yes, have_tempo2_lib=no)
+
+    AC_MSG_RESULT($have_tempo2_lib)
+
+  fi
+
   LIBS="$ac_save_LIBS"
   CXXFLAGS="$ac_save_CXXFLAGS"
 
@@ -46,6 +70,11 @@ AC_DEFUN([SWIN_LIB_TEMPO2],
 
   if test x"$have_tempo2" = xyes; then
     AC_DEFINE([HAVE_TEMPO2], [1], [Define to 1 if you have the TEMPO2 library])
+    if test x"$have_tempo2_lib" = xyes; then
+      AC_DEFINE([HAVE_TEMPO2_LIB], [1],
+                [Define to 1 if predictors can be generated in-process])
+      TEMPO2_LIBS="$TEMPO2_LIB_LIBS"
+    fi
     [$1]
   else
     AC_MSG_WARN([TEMPO2 code will not be compiled])